@@ -75,6 +75,11 @@ private:
 
   Teuchos::RCP<const Teuchos::ParameterList>
      getValidLaserSourceParameters() const;
+
+  //! True if the box [x_min,x_max]x[y_min,y_max] intersects the beam disc
+  bool isBoxInBeam(const RealType x_min, const RealType x_max,
+                   const RealType y_min, const RealType y_max,
+                   const RealType cx, const RealType cy, const RealType r) const;
 };
 }
 
@@ -3,7 +3,9 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include "Sacado_ParameterRegistration.hpp"
 #include "Albany_Utils.hpp"
 
@@ -169,17 +171,60 @@ evaluateFields(typename Traits::EvalData workset)
   ScalarT f3 = 3.0*(1.0 - powder_hemispherical_reflectivity);
 
 //-----------------------------------------------------------------------------------------------
+// Active region: the source vanishes outside the beam radius, so cells whose
+// quadrature points all lie outside the disc around the laser center only
+// need to be zeroed. With the laser off, or a workset entirely outside the
+// disc, the whole workset is zeroed without touching the depth profile.
+  const RealType cx = x, cy = y;
+  const RealType r_beam = Sacado::ScalarValue<ScalarT>::eval(laser_beam_radius);
+
+  bool workset_active = (power == 1);
+  if (workset_active) {
+    RealType x_min = std::numeric_limits<RealType>::max(), x_max = -x_min;
+    RealType y_min = x_min, y_max = -x_min;
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+      for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+        const RealType X = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,0));
+        const RealType Y = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,1));
+        x_min = std::min(x_min, X); x_max = std::max(x_max, X);
+        y_min = std::min(y_min, Y); y_max = std::max(y_max, Y);
+      }
+    }
+    workset_active = isBoxInBeam(x_min, x_max, y_min, y_max, cx, cy, r_beam);
+  }
+
+  if (!workset_active) {
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+      for (std::size_t qp = 0; qp < num_qps_; ++qp)
+        laser_source_(cell,qp) = 0.0;
+    return;
+  }
+
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+    RealType x_min = std::numeric_limits<RealType>::max(), x_max = -x_min;
+    RealType y_min = x_min, y_max = -x_min;
+    for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+      const RealType X = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,0));
+      const RealType Y = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,1));
+      x_min = std::min(x_min, X); x_max = std::max(x_max, X);
+      y_min = std::min(y_min, Y); y_max = std::max(y_max, Y);
+    }
+    if (!isBoxInBeam(x_min, x_max, y_min, y_max, cx, cy, r_beam)) {
+      for (std::size_t qp = 0; qp < num_qps_; ++qp)
+        laser_source_(cell,qp) = 0.0;
+      continue;
+    }
+
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
 	  MeshScalarT X = coord_(cell,qp,0);
 	  MeshScalarT Y = coord_(cell,qp,1);
 	  MeshScalarT Z = coord_(cell,qp,2);
 
-    ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
-    MeshScalarT* XX = &coord_(cell,qp,0);
     ScalarT radius = sqrt((X - Laser_center_x)*(X - Laser_center_x) + (Y - Laser_center_y)*(Y - Laser_center_y));
-     if (radius < laser_beam_radius && beta*Z <= lambda)
-            laser_source_(cell,qp) = beta*LaserFlux_Max*pow((1.0-(radius*radius)/(laser_beam_radius*laser_beam_radius)),2)*depth_profile;
+     if (radius < laser_beam_radius && beta*Z <= lambda) {
+       ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
+       laser_source_(cell,qp) = beta*LaserFlux_Max*pow((1.0-(radius*radius)/(laser_beam_radius*laser_beam_radius)),2)*depth_profile;
+     }
      else   laser_source_(cell,qp) = 0.0;
 	
     }
@@ -187,6 +232,18 @@ evaluateFields(typename Traits::EvalData workset)
 }
 //**********************************************************************
 template<typename EvalT, typename Traits>
+bool LaserSource<EvalT, Traits>::
+isBoxInBeam(const RealType x_min, const RealType x_max,
+            const RealType y_min, const RealType y_max,
+            const RealType cx, const RealType cy, const RealType r) const
+{
+  // distance from the beam center to the closest point of the box
+  const RealType dx = std::max(std::max(x_min - cx, cx - x_max), 0.0);
+  const RealType dy = std::max(std::max(y_min - cy, cy - y_max), 0.0);
+  return dx*dx + dy*dy < r*r;
+}
+//**********************************************************************
+template<typename EvalT, typename Traits>
 Teuchos::RCP<const Teuchos::ParameterList>
 LaserSource<EvalT, Traits>::
 getValidLaserSourceParameters() const
@@ -102,6 +102,7 @@ void Albany::AMPThermoMechanics::constructDirichletEvaluators(
   dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
       this->params, this->paramLib);
   offsets_ = bcUtils.getOffsets(); 
+  dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -78,6 +78,7 @@ void Albany::AdvectionProblem::constructDirichletEvaluators(
   dfm = bcUtils.constructBCEvaluators(
       nodeSetIDs, bcNames, this->params, this->paramLib);
   offsets_ = bcUtils.getOffsets();
+  dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 void Albany::AdvectionProblem::constructNeumannEvaluators(
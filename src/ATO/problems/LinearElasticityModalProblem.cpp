@@ -105,6 +105,7 @@ Albany::LinearElasticityModalProblem::constructDirichletEvaluators(
   dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                        this->params, this->paramLib);
   offsets_ = dirUtils.getOffsets(); 
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
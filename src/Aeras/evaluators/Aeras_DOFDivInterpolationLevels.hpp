@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_SumFactorization.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -65,6 +66,10 @@ private:
   Kokkos::DynRankView<RealType, PHX::Device>    grad_at_cub_points;
   Kokkos::DynRankView<ScalarT, PHX::Device>     vcontra;
 
+  SumFactorization sumFact;
+  bool useSumFactorization;
+  int numPoints1D;
+
   const int numNodes;
   const int numDims;
   const int numQPs;
@@ -42,6 +42,13 @@ DOFDivInterpolationLevels(Teuchos::ParameterList& p,
       p.get<Teuchos::ParameterList*>("Hydrostatic Problem");
   originalDiv = xsa_params->get<bool>("Original Divergence", true);
 
+  // The contravariant form of the divergence is sum-factorized on
+  // tensor-product spectral elements.
+  sumFact = SumFactorization(intrepidBasis, cubature);
+  useSumFactorization = !originalDiv && sumFact.isTensorProduct() &&
+                        xsa_params->get<bool>("Use Sum Factorization", true);
+  numPoints1D = sumFact.numPoints1D();
+
   std::cout << "ORIGINAL DIV ? " << originalDiv <<"\n";
 
   //OG Since there are a few evaluators that use div, it is possible to control
@@ -112,9 +119,17 @@ operator() (const DOFDivInterpolationLevels_Tag& tag, const int& cell) const{
   for (int qp=0; qp < numQPs; ++qp) {
     for (int level=0; level < numLevels; ++level) {
       div_val_qp(cell, qp, level) = 0;
-      for (int node=0; node < numNodes; ++node) {
-        div_val_qp(cell, qp, level) += vcontra(cell, node, level, 0)*grad_at_cub_points(node, qp, 0)
-                                    +  vcontra(cell, node, level, 1)*grad_at_cub_points(node, qp, 1);
+      if (useSumFactorization) {
+        for (int a=0; a < numPoints1D; ++a) {
+          div_val_qp(cell, qp, level) += vcontra(cell, sumFact.lineNodes(qp, 0, a), level, 0)*sumFact.lineWeights(qp, 0, a)
+                                      +  vcontra(cell, sumFact.lineNodes(qp, 1, a), level, 1)*sumFact.lineWeights(qp, 1, a);
+        }
+      }
+      else {
+        for (int node=0; node < numNodes; ++node) {
+          div_val_qp(cell, qp, level) += vcontra(cell, node, level, 0)*grad_at_cub_points(node, qp, 0)
+                                      +  vcontra(cell, node, level, 1)*grad_at_cub_points(node, qp, 1);
+        }
       }
       div_val_qp(cell, qp, level) /= jacobian_det(cell, qp);
     }
@@ -161,9 +176,17 @@ evaluateFields(typename Traits::EvalData workset)
 
         for (int qp=0; qp < numQPs; ++qp) {
           div_val_qp(cell, qp, level) = 0;
-          for (int node=0; node < numNodes; ++node) {
-            div_val_qp(cell, qp, level) += vcontra(node, 0)*grad_at_cub_points(node, qp, 0)
-                                        +  vcontra(node, 1)*grad_at_cub_points(node, qp, 1);
+          if (useSumFactorization) {
+            for (int a=0; a < numPoints1D; ++a) {
+              div_val_qp(cell, qp, level) += vcontra(sumFact.lineNodes(qp, 0, a), 0)*sumFact.lineWeights(qp, 0, a)
+                                          +  vcontra(sumFact.lineNodes(qp, 1, a), 1)*sumFact.lineWeights(qp, 1, a);
+            }
+          }
+          else {
+            for (int node=0; node < numNodes; ++node) {
+              div_val_qp(cell, qp, level) += vcontra(node, 0)*grad_at_cub_points(node, qp, 0)
+                                          +  vcontra(node, 1)*grad_at_cub_points(node, qp, 1);
+            }
           }
           div_val_qp(cell, qp, level) /= jacobian_det(cell,qp);
         }
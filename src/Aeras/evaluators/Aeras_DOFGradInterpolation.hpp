@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 
 #include "Aeras_Layouts.hpp"
+#include "Aeras_SumFactorization.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -20,6 +21,11 @@ namespace Aeras {
     This evaluator interpolates nodal DOF values to their
     gradients at quad points.
 
+    If "Intrepid2 Basis", "Cubature" and "Jacobian Inv Name" are given and
+    the element is a tensor-product spectral element, the gradient is
+    computed with sum-factorized 1D contractions followed by the inverse
+    Jacobian transform instead of the dense GradBF contraction.
+
 */
 
 template<typename EvalT, typename Traits>
@@ -47,6 +53,9 @@ private:
   //! Basis Functions
   PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
 
+  //! Inverse Jacobian, only used on the sum-factorized path
+  PHX::MDField<const MeshScalarT,Cell,QuadPoint,Dim,Dim> jacobian_inv;
+
   // Output:
   //! Values at quadrature points
   PHX::MDField<ScalarT,Cell,QuadPoint,Dim> grad_val_qp;
@@ -55,17 +64,26 @@ private:
   const int numDims;
   const int numQPs;
 
+  SumFactorization sumFact;
+  bool useSumFactorization;
+  int numPoints1D;
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
 
   struct DOFGradInterpolation_Tag{};
+  struct DOFGradInterpolation_SumFactorization_Tag{};
 
   typedef Kokkos::RangePolicy<ExecutionSpace, DOFGradInterpolation_Tag> DOFGradInterpolation_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, DOFGradInterpolation_SumFactorization_Tag> DOFGradInterpolation_SumFactorization_Policy;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const DOFGradInterpolation_Tag& tag, const int& i) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFGradInterpolation_SumFactorization_Tag& tag, const int& i) const;
+
 #endif
 };
 
@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_SumFactorization.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -21,6 +22,10 @@ namespace Aeras {
     This evaluator interpolates nodal DOF values to their
     gradients at quad points.
 
+    On tensor-product spectral elements (with "Intrepid2 Basis",
+    "Cubature" and "Jacobian Inv Name" given) the gradient is sum-factorized
+    level by level, see Aeras::SumFactorization.
+
 */
 
 template<typename EvalT, typename Traits>
@@ -48,6 +53,9 @@ private:
   //! Basis Functions
   PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
 
+  //! Inverse Jacobian, only used on the sum-factorized path
+  PHX::MDField<const MeshScalarT,Cell,QuadPoint,Dim,Dim> jacobian_inv;
+
   // Output:
   //! Values at quadrature points
   PHX::MDField<ScalarT,Cell,QuadPoint,Level,Dim> grad_val_qp;
@@ -57,17 +65,26 @@ private:
   const int numQPs;
   const int numLevels;
 
+  SumFactorization sumFact;
+  bool useSumFactorization;
+  int numPoints1D;
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
 
   struct DOFGradInterpolationLevels_Tag{};
+  struct DOFGradInterpolationLevels_SumFactorization_Tag{};
 
   typedef Kokkos::RangePolicy<ExecutionSpace, DOFGradInterpolationLevels_Tag> DOFGradInterpolationLevels_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, DOFGradInterpolationLevels_SumFactorization_Tag> DOFGradInterpolationLevels_SumFactorization_Policy;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const DOFGradInterpolationLevels_Tag& tag, const int& i) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFGradInterpolationLevels_SumFactorization_Tag& tag, const int& i) const;
+
 #endif
 };
 
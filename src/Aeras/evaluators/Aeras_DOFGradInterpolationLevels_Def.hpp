@@ -23,10 +23,26 @@ DOFGradInterpolationLevels(Teuchos::ParameterList& p,
   numNodes   (dl->node_scalar             ->dimension(1)),
   numDims    (dl->node_qp_gradient        ->dimension(3)),
   numQPs     (dl->node_qp_scalar          ->dimension(2)),
-  numLevels  (dl->node_scalar_level       ->dimension(2))
+  numLevels  (dl->node_scalar_level       ->dimension(2)),
+  useSumFactorization(false),
+  numPoints1D(0)
 {
+  if (p.isParameter("Intrepid2 Basis") && p.isParameter("Cubature") &&
+      p.isParameter("Jacobian Inv Name")) {
+    sumFact = SumFactorization(
+        p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > >("Intrepid2 Basis"),
+        p.get<Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature"));
+    useSumFactorization = sumFact.isTensorProduct() && sumFact.numDims() == numDims;
+    numPoints1D = sumFact.numPoints1D();
+  }
+
   this->addDependentField(val_node);
-  this->addDependentField(GradBF);
+  if (useSumFactorization) {
+    jacobian_inv = decltype(jacobian_inv)(p.get<std::string>("Jacobian Inv Name"), dl->qp_tensor);
+    this->addDependentField(jacobian_inv);
+  }
+  else
+    this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
   this->setName("Aeras::DOFGradInterpolationLevels"+PHX::typeAsString<EvalT>());
@@ -41,7 +57,10 @@ postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
   this->utils.setFieldData(val_node,fm);
-  this->utils.setFieldData(GradBF,fm);
+  if (useSumFactorization)
+    this->utils.setFieldData(jacobian_inv,fm);
+  else
+    this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
 }
 
@@ -64,6 +83,28 @@ operator() (const DOFGradInterpolationLevels_Tag& tag, const int& cell) const{
   }
 }
 
+
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFGradInterpolationLevels<EvalT, Traits>::
+operator() (const DOFGradInterpolationLevels_SumFactorization_Tag& tag, const int& cell) const{
+  for (int qp=0; qp < numQPs; ++qp) {
+    for (int level=0; level < numLevels; ++level) {
+      ScalarT ref_grad[3];
+      for (int d=0; d<numDims; d++) {
+        ref_grad[d] = 0;
+        for (int a=0; a < numPoints1D; ++a)
+          ref_grad[d] += val_node(cell, sumFact.lineNodes(qp, d, a), level) * sumFact.lineWeights(qp, d, a);
+      }
+      for (int dim=0; dim<numDims; dim++) {
+        grad_val_qp(cell,qp,level,dim) = 0;
+        for (int d=0; d<numDims; d++)
+          grad_val_qp(cell,qp,level,dim) += jacobian_inv(cell, qp, d, dim) * ref_grad[d];
+      }
+    }
+  }
+}
+
 #endif
 
 //**********************************************************************
@@ -102,6 +143,27 @@ evaluateFields(typename Traits::EvalData workset)
   }
   */
 
+  if (useSumFactorization) {
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int qp=0; qp < numQPs; ++qp) {
+        for (int level=0; level < numLevels; ++level) {
+          ScalarT ref_grad[3];
+          for (int d=0; d<numDims; d++) {
+            ref_grad[d] = 0;
+            for (int a=0; a < numPoints1D; ++a)
+              ref_grad[d] += val_node(cell, sumFact.lineNodes(qp, d, a), level) * sumFact.lineWeights(qp, d, a);
+          }
+          for (int dim=0; dim<numDims; dim++) {
+            grad_val_qp(cell,qp,level,dim) = 0;
+            for (int d=0; d<numDims; d++)
+              grad_val_qp(cell,qp,level,dim) += jacobian_inv(cell, qp, d, dim) * ref_grad[d];
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
       for (int level=0; level < numLevels; ++level) {
@@ -123,7 +185,10 @@ evaluateFields(typename Traits::EvalData workset)
 */
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolationLevels_Policy(0,workset.numCells),*this);
+  if (useSumFactorization)
+    Kokkos::parallel_for(DOFGradInterpolationLevels_SumFactorization_Policy(0,workset.numCells),*this);
+  else
+    Kokkos::parallel_for(DOFGradInterpolationLevels_Policy(0,workset.numCells),*this);
 
 #endif
 }
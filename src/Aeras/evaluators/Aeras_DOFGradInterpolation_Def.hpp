@@ -22,10 +22,26 @@ DOFGradInterpolation(Teuchos::ParameterList& p,
   grad_val_qp (p.get<std::string>   ("Gradient Variable Name"),dl->qp_gradient), 
   numNodes   (dl->node_scalar             ->dimension(1)),
   numDims    (dl->node_qp_gradient        ->dimension(3)),
-  numQPs     (dl->node_qp_scalar          ->dimension(2))
+  numQPs     (dl->node_qp_scalar          ->dimension(2)),
+  useSumFactorization(false),
+  numPoints1D(0)
 {
+  if (p.isParameter("Intrepid2 Basis") && p.isParameter("Cubature") &&
+      p.isParameter("Jacobian Inv Name")) {
+    sumFact = SumFactorization(
+        p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > >("Intrepid2 Basis"),
+        p.get<Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature"));
+    useSumFactorization = sumFact.isTensorProduct() && sumFact.numDims() == numDims;
+    numPoints1D = sumFact.numPoints1D();
+  }
+
   this->addDependentField(val_node);
-  this->addDependentField(GradBF);
+  if (useSumFactorization) {
+    jacobian_inv = decltype(jacobian_inv)(p.get<std::string>("Jacobian Inv Name"), dl->qp_tensor);
+    this->addDependentField(jacobian_inv);
+  }
+  else
+    this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
   this->setName("Aeras::DOFGradInterpolation" );
@@ -38,7 +54,10 @@ postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
   this->utils.setFieldData(val_node,fm);
-  this->utils.setFieldData(GradBF,fm);
+  if (useSumFactorization)
+    this->utils.setFieldData(jacobian_inv,fm);
+  else
+    this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
 }
 
@@ -59,6 +78,25 @@ operator() (const DOFGradInterpolation_Tag& tag, const int& cell) const{
   }
 }
 
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFGradInterpolation<EvalT, Traits>::
+operator() (const DOFGradInterpolation_SumFactorization_Tag& tag, const int& cell) const{
+  for (int qp=0; qp < numQPs; ++qp) {
+    ScalarT ref_grad[3];
+    for (int d=0; d<numDims; d++) {
+      ref_grad[d] = 0;
+      for (int a=0; a < numPoints1D; ++a)
+        ref_grad[d] += val_node(cell, sumFact.lineNodes(qp, d, a)) * sumFact.lineWeights(qp, d, a);
+    }
+    for (int dim=0; dim<numDims; dim++) {
+      grad_val_qp(cell,qp,dim) = 0;
+      for (int d=0; d<numDims; d++)
+        grad_val_qp(cell,qp,dim) += jacobian_inv(cell, qp, d, dim) * ref_grad[d];
+    }
+  }
+}
+
 #endif
 
 //**********************************************************************
@@ -71,6 +109,27 @@ evaluateFields(typename Traits::EvalData workset)
   // for (int i=0; i < grad_val_qp.size() ; i++) grad_val_qp[i] = 0.0;
   // Intrepid2::FunctionSpaceTools:: evaluate<ScalarT>(grad_val_qp, val_node, GradBF);
 
+  if (useSumFactorization) {
+    // Reference gradient by 1D contractions along the grid lines through
+    // each qp, then grad = J^{-T} * ref_grad.
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int qp=0; qp < numQPs; ++qp) {
+        ScalarT ref_grad[3];
+        for (int d=0; d<numDims; d++) {
+          ref_grad[d] = 0;
+          for (int a=0; a < numPoints1D; ++a)
+            ref_grad[d] += val_node(cell, sumFact.lineNodes(qp, d, a)) * sumFact.lineWeights(qp, d, a);
+        }
+        for (int dim=0; dim<numDims; dim++) {
+          grad_val_qp(cell,qp,dim) = 0;
+          for (int d=0; d<numDims; d++)
+            grad_val_qp(cell,qp,dim) += jacobian_inv(cell, qp, d, dim) * ref_grad[d];
+        }
+      }
+    }
+    return;
+  }
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
       for (int dim=0; dim<numDims; dim++) {
@@ -83,7 +142,10 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolation_Policy(0,workset.numCells),*this);
+  if (useSumFactorization)
+    Kokkos::parallel_for(DOFGradInterpolation_SumFactorization_Policy(0,workset.numCells),*this);
+  else
+    Kokkos::parallel_for(DOFGradInterpolation_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -18,6 +18,8 @@
 #include <Intrepid2_Basis.hpp>
 #include <Intrepid2_Cubature.hpp>
 
+#include "Aeras_SumFactorization.hpp"
+
 
 //#define ALBANY_KOKKOS_UNDER_DEVELOPMENT
 
@@ -91,6 +93,12 @@ private:
 	Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
 	Kokkos::DynRankView<RealType, PHX::Device>    refPoints;
 	Kokkos::DynRankView<RealType, PHX::Device>    refWeights;
+
+	//Line tables for sum-factorized gradient/divergence/curl on
+	//tensor-product spectral elements
+	SumFactorization sumFact;
+	bool useSumFactorization;
+	int numPoints1D;
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 	Kokkos::DynRankView<MeshScalarT, PHX::Device>  nodal_jacobian;
 	Kokkos::DynRankView<MeshScalarT, PHX::Device>  nodal_inv_jacobian;
@@ -89,6 +89,13 @@ ShallowWaterResid(const Teuchos::ParameterList& p,
 
   AlphaAngle = shallowWaterList->get<double>("Rotation Angle", 0.0); //Default: 0.0
 
+  //Sum-factorized kernels are used automatically on tensor-product
+  //spectral elements; the dense basis tables remain the fallback.
+  if (shallowWaterList->get<bool>("Use Sum Factorization", true))
+    sumFact = SumFactorization(intrepidBasis, cubature);
+  useSumFactorization = sumFact.isTensorProduct();
+  numPoints1D = sumFact.numPoints1D();
+
   const CellTopologyData *ctd = cellType->getCellTopologyData();
   int nNodes = ctd->node_count;
   int nDim   = ctd->dimension;
@@ -351,15 +358,26 @@ void ShallowWaterResid<EvalT,Traits>::divergence4(const Kokkos::DynRankView<Scal
     tempnodalvec1(cell, node, 1 ) = det_j*(jinv10*fieldAtNodes(cell, node, 0) + jinv11*fieldAtNodes(cell, node, 1) );
   }
 
-  for (int qp=0; qp < numQPs; ++qp) {
-    div_(cell, qp) = 0.0;
-    for (int node=0; node < numNodes; ++node) {
-      //OG What is this commented code?
-      //ScalarT tempAdd =vcontra(node, 0)*grad_at_cub_points_Kokkos(node, qp,0)
-      //                + vcontra(node, 1)*grad_at_cub_points_Kokkos(node, qp,1);
-      //     Kokkos::atomic_fetch_add(&div_hU(qp), tempAdd);
-      div_(cell, qp) += tempnodalvec1(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 0)
-                     +  tempnodalvec1(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 1);
+  if (useSumFactorization) {
+    for (int qp=0; qp < numQPs; ++qp) {
+      div_(cell, qp) = 0.0;
+      for (int a=0; a < numPoints1D; ++a) {
+        div_(cell, qp) += tempnodalvec1(cell, sumFact.lineNodes(qp, 0, a), 0)*sumFact.lineWeights(qp, 0, a)
+                       +  tempnodalvec1(cell, sumFact.lineNodes(qp, 1, a), 1)*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+  }
+  else {
+    for (int qp=0; qp < numQPs; ++qp) {
+      div_(cell, qp) = 0.0;
+      for (int node=0; node < numNodes; ++node) {
+        //OG What is this commented code?
+        //ScalarT tempAdd =vcontra(node, 0)*grad_at_cub_points_Kokkos(node, qp,0)
+        //                + vcontra(node, 1)*grad_at_cub_points_Kokkos(node, qp,1);
+        //     Kokkos::atomic_fetch_add(&div_hU(qp), tempAdd);
+        div_(cell, qp) += tempnodalvec1(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 0)
+                       +  tempnodalvec1(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 1);
+      }
     }
   }
 
@@ -384,11 +402,19 @@ gradient4(const Kokkos::DynRankView<ScalarT, PHX::Device>  & field,
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
-    for (std::size_t node=0; node < numNodes; ++node) {
-      //const typename PHAL::Ref<const ScalarT>::type
-      const ScalarT field_ = field(cell,node);
-      gx += field_*grad_at_cub_points_Kokkos(node, qp,0);
-      gy += field_*grad_at_cub_points_Kokkos(node, qp,1);
+    if (useSumFactorization) {
+      for (int a=0; a < numPoints1D; ++a) {
+        gx += field(cell, sumFact.lineNodes(qp, 0, a))*sumFact.lineWeights(qp, 0, a);
+        gy += field(cell, sumFact.lineNodes(qp, 1, a))*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+    else {
+      for (std::size_t node=0; node < numNodes; ++node) {
+        //const typename PHAL::Ref<const ScalarT>::type
+        const ScalarT field_ = field(cell,node);
+        gx += field_*grad_at_cub_points_Kokkos(node, qp,0);
+        gy += field_*grad_at_cub_points_Kokkos(node, qp,1);
+      }
     }
 
     gradient_(cell,qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
@@ -421,9 +447,17 @@ void ShallowWaterResid<EvalT,Traits>::curl4(
   }
   for (int qp=0; qp < numQPs; ++qp) {
     curl_(cell, qp) = 0.0;
-    for (int node=0; node < numNodes; ++node) {
-      curl_(cell, qp) += tempnodalvec2(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 0)
-      		      -  tempnodalvec2(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 1);
+    if (useSumFactorization) {
+      for (int a=0; a < numPoints1D; ++a) {
+        curl_(cell, qp) += tempnodalvec2(cell, sumFact.lineNodes(qp, 0, a), 1)*sumFact.lineWeights(qp, 0, a)
+                        -  tempnodalvec2(cell, sumFact.lineNodes(qp, 1, a), 0)*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+    else {
+      for (int node=0; node < numNodes; ++node) {
+        curl_(cell, qp) += tempnodalvec2(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 0)
+                        -  tempnodalvec2(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 1);
+      }
     }
     curl_(cell, qp) = curl_(cell, qp)/jacobian_det(cell, qp);
   }
@@ -1616,10 +1650,20 @@ ShallowWaterResid<EvalT,Traits>::divergence(const Kokkos::DynRankView<ScalarT, P
 			jinv10*fieldAtNodes(node, 0)+ jinv11*fieldAtNodes(node, 1) );
   }
 
-  for (std::size_t qp=0; qp < numQPs; ++qp) {
-    for (std::size_t node=0; node < numNodes; ++node) {
-      div(qp) += vcontra(node, 0)*grad_at_cub_points(node, qp,0)
-               + vcontra(node, 1)*grad_at_cub_points(node, qp,1);
+  if (useSumFactorization) {
+    for (std::size_t qp=0; qp < numQPs; ++qp) {
+      for (int a=0; a < numPoints1D; ++a) {
+        div(qp) += vcontra(sumFact.lineNodes(qp, 0, a), 0)*sumFact.lineWeights(qp, 0, a)
+                 + vcontra(sumFact.lineNodes(qp, 1, a), 1)*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+  }
+  else {
+    for (std::size_t qp=0; qp < numQPs; ++qp) {
+      for (std::size_t node=0; node < numNodes; ++node) {
+        div(qp) += vcontra(node, 0)*grad_at_cub_points(node, qp,0)
+                 + vcontra(node, 1)*grad_at_cub_points(node, qp,1);
+      }
     }
   }
 
@@ -1651,9 +1695,17 @@ ShallowWaterResid<EvalT,Traits>::gradient(const Kokkos::DynRankView<ScalarT, PHX
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
-    for (std::size_t node=0; node < numNodes; ++node) {
-      gx +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,0);
-      gy +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,1);
+    if (useSumFactorization) {
+      for (int a=0; a < numPoints1D; ++a) {
+        gx += fieldAtNodes(sumFact.lineNodes(qp, 0, a))*sumFact.lineWeights(qp, 0, a);
+        gy += fieldAtNodes(sumFact.lineNodes(qp, 1, a))*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+    else {
+      for (std::size_t node=0; node < numNodes; ++node) {
+        gx +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,0);
+        gy +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,1);
+      }
     }
     gradField(qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
     gradField(qp, 1) = jacobian_inv(cell, qp, 0, 1)*gx + jacobian_inv(cell, qp, 1, 1)*gy;
@@ -1712,9 +1764,17 @@ ShallowWaterResid<EvalT,Traits>::curl(const Kokkos::DynRankView<ScalarT, PHX::De
 
 
   for (std::size_t qp=0; qp < numQPs; ++qp) {
-    for (std::size_t node=0; node < numNodes; ++node) {
-      curl(qp) += covariantVector(node, 1)*grad_at_cub_points(node, qp,0)
-                - covariantVector(node, 0)*grad_at_cub_points(node, qp,1);
+    if (useSumFactorization) {
+      for (int a=0; a < numPoints1D; ++a) {
+        curl(qp) += covariantVector(sumFact.lineNodes(qp, 0, a), 1)*sumFact.lineWeights(qp, 0, a)
+                  - covariantVector(sumFact.lineNodes(qp, 1, a), 0)*sumFact.lineWeights(qp, 1, a);
+      }
+    }
+    else {
+      for (std::size_t node=0; node < numNodes; ++node) {
+        curl(qp) += covariantVector(node, 1)*grad_at_cub_points(node, qp,0)
+                  - covariantVector(node, 0)*grad_at_cub_points(node, qp,1);
+      }
     }
     curl(qp) = curl(qp)/jacobian_det(cell,qp);
   }
@@ -0,0 +1,132 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Aeras_SumFactorization.hpp"
+
+namespace Aeras {
+
+namespace {
+
+const RealType tol = 1.0e-8;
+
+// Index of x in the sorted list of distinct coordinates, or -1.
+int coordIndex (const std::vector<RealType>& coords, const RealType x)
+{
+  for (int i=0; i<coords.size(); ++i)
+    if (std::abs(coords[i] - x) < tol) return i;
+  return -1;
+}
+
+} // namespace
+
+//**********************************************************************
+SumFactorization::SumFactorization () :
+  tensorProduct(false),
+  dim(0),
+  np(0)
+{
+}
+
+//**********************************************************************
+SumFactorization::SumFactorization (
+    const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> >& basis,
+    const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> >& cubature) :
+  tensorProduct(false),
+  dim(cubature->getDimension()),
+  np(0)
+{
+  const int numNodes = basis->getCardinality();
+  const int numQPs   = cubature->getNumPoints();
+
+  // Spectral elements are collocated: one qp per node.
+  if (numNodes != numQPs || dim < 2) return;
+
+  np = static_cast<int>(std::floor(std::pow(numQPs, 1.0/dim) + 0.5));
+  int npDim = 1;
+  for (int d=0; d<dim; ++d) npDim *= np;
+  if (np < 2 || npDim != numQPs) return;
+
+  Kokkos::DynRankView<RealType, PHX::Device> refPoints("refPoints", numQPs, dim);
+  Kokkos::DynRankView<RealType, PHX::Device> refWeights("refWeights", numQPs);
+  Kokkos::DynRankView<RealType, PHX::Device> val("val", numNodes, numQPs);
+  Kokkos::DynRankView<RealType, PHX::Device> grad("grad", numNodes, numQPs, dim);
+  cubature->getCubature(refPoints, refWeights);
+  basis->getValues(val,  refPoints, Intrepid2::OPERATOR_VALUE);
+  basis->getValues(grad, refPoints, Intrepid2::OPERATOR_GRAD);
+
+  // Distinct 1D coordinates in each direction.
+  std::vector<std::vector<RealType> > coords(dim);
+  for (int d=0; d<dim; ++d) {
+    for (int qp=0; qp<numQPs; ++qp)
+      if (coordIndex(coords[d], refPoints(qp,d)) < 0)
+        coords[d].push_back(refPoints(qp,d));
+    if (coords[d].size() != np) return;
+    std::sort(coords[d].begin(), coords[d].end());
+  }
+
+  // Lexicographic position of each qp, and the node collocated with it.
+  std::vector<int> qpLex(numQPs), lexToQP(numQPs, -1), qpToNode(numQPs, -1);
+  std::vector<int> ijk(numQPs*dim);
+  for (int qp=0; qp<numQPs; ++qp) {
+    int lex = 0, stride = 1;
+    for (int d=0; d<dim; ++d) {
+      const int i = coordIndex(coords[d], refPoints(qp,d));
+      ijk[qp*dim+d] = i;
+      lex += i*stride;
+      stride *= np;
+    }
+    if (lexToQP[lex] >= 0) return;
+    qpLex[qp] = lex;
+    lexToQP[lex] = qp;
+
+    for (int node=0; node<numNodes; ++node) {
+      const RealType v = val(node,qp);
+      if (std::abs(v - 1.0) < tol) {
+        if (qpToNode[qp] >= 0) return;
+        qpToNode[qp] = node;
+      }
+      else if (std::abs(v) > tol) return;
+    }
+    if (qpToNode[qp] < 0) return;
+  }
+
+  lineNodes   = Kokkos::View<int***, PHX::Device>("lineNodes", numQPs, dim, np);
+  lineWeights = Kokkos::View<RealType***, PHX::Device>("lineWeights", numQPs, dim, np);
+  Kokkos::View<int***, PHX::Device>::HostMirror
+    lineNodes_h = Kokkos::create_mirror_view(lineNodes);
+  Kokkos::View<RealType***, PHX::Device>::HostMirror
+    lineWeights_h = Kokkos::create_mirror_view(lineWeights);
+
+  std::vector<bool> onLine(numNodes);
+  for (int qp=0; qp<numQPs; ++qp) {
+    int stride = 1;
+    for (int d=0; d<dim; ++d) {
+      std::fill(onLine.begin(), onLine.end(), false);
+      const int base = qpLex[qp] - ijk[qp*dim+d]*stride;
+      for (int a=0; a<np; ++a) {
+        const int node = qpToNode[lexToQP[base + a*stride]];
+        onLine[node] = true;
+        lineNodes_h(qp,d,a)   = node;
+        lineWeights_h(qp,d,a) = grad(node,qp,d);
+      }
+      // The derivative along d must vanish for every node off the line,
+      // otherwise the basis is not a tensor product of 1D Lagrange bases.
+      for (int node=0; node<numNodes; ++node)
+        if (!onLine[node] && std::abs(grad(node,qp,d)) > tol) return;
+      stride *= np;
+    }
+  }
+
+  Kokkos::deep_copy(lineNodes, lineNodes_h);
+  Kokkos::deep_copy(lineWeights, lineWeights_h);
+  tensorProduct = true;
+}
+
+} // namespace Aeras
@@ -0,0 +1,73 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_SUMFACTORIZATION_HPP
+#define AERAS_SUMFACTORIZATION_HPP
+
+#include "Teuchos_RCP.hpp"
+#include "Phalanx_config.hpp"
+
+#include <Intrepid2_Basis.hpp>
+#include <Intrepid2_Cubature.hpp>
+
+#include "Albany_DataTypes.hpp"
+
+namespace Aeras {
+
+/** \brief Sum-factorized kernels for tensor-product spectral elements
+
+    For Lagrange bases on quads/hexes whose nodes coincide with the points
+    of a tensor-product (GLL) cubature, the reference derivative of basis
+    function n at quadrature point q in direction d is nonzero only if n
+    lies on the grid line through q along d.  The reference gradient of a
+    nodal field then reduces to np-term 1D contractions along those lines,
+    i.e. O(np^(dim+1)) work per element instead of the O(np^(2 dim)) of
+    the dense numNodes x numQPs basis tables.
+
+    This class detects that structure from the Intrepid2 basis and
+    cubature and stores, for each (qp, direction), the np nodes on the line
+    and the 1D derivative weights, so that a reference derivative is
+
+      for (int a=0; a<np; ++a)
+        g += lineWeights(qp,d,a)*u(lineNodes(qp,d,a));
+
+    If the element is not tensor-product or not collocated,
+    isTensorProduct() returns false and callers keep using the dense tables.
+*/
+class SumFactorization {
+
+public:
+
+  SumFactorization ();
+
+  SumFactorization (
+      const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> >& basis,
+      const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> >& cubature);
+
+  //! True if the line tables below are valid for this basis/cubature pair.
+  bool isTensorProduct () const { return tensorProduct; }
+
+  //! Spatial dimension of the reference element.
+  int numDims () const { return dim; }
+
+  //! Number of points per direction.
+  int numPoints1D () const { return np; }
+
+  //! (qp, direction, a) -> node index of the a-th point on the grid line
+  Kokkos::View<int***, PHX::Device> lineNodes;
+  //! (qp, direction, a) -> reference derivative of that node's basis function
+  Kokkos::View<RealType***, PHX::Device> lineWeights;
+
+private:
+
+  bool tensorProduct;
+  int dim;
+  int np;
+};
+
+} // namespace Aeras
+
+#endif
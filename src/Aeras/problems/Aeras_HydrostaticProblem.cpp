@@ -133,6 +133,7 @@ Aeras::HydrostaticProblem::constructDirichletEvaluators(
                                         this->params,
                                         this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -208,6 +208,18 @@ Aeras::HydrostaticProblem::constructEvaluators(
 
   //Evaluators for DOFs that depend on levels
   
+  // Gradients on tensor-product spectral elements are sum-factorized;
+  // the DOF gradient evaluators need the basis, cubature and J^{-1} for that.
+  const bool useSumFactorization =
+    params->sublist("Hydrostatic Problem").get<bool>("Use Sum Factorization", true);
+  auto setSumFactorization = [&](ParameterList& pl) {
+    if (useSumFactorization) {
+      pl.set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      pl.set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > >("Intrepid2 Basis", intrepidBasis);
+      pl.set<string>("Jacobian Inv Name", "Jacobian Inv");
+    }
+  };
+
   //Evaluators for DOFs that depend on levels
   dl = rcp(new Aeras::Layouts(worksetSize,numVertices,numNodes,numQPts,numDim, vecDim, numLevels));
   Albany::EvaluatorUtils<EvalT, PHAL::AlbanyTraits> evalUtils(dl);
@@ -303,6 +315,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name",          dof_names_nodes[0]);
     p->set<string>("Gradient BF Name",       "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_nodes_gradient[0]);
+    setSumFactorization(*p);
 
     ev = rcp(new Aeras::DOFGradInterpolation<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -314,6 +327,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", dof_names_tracers[t]);
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
+    setSumFactorization(*p);
 
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -431,6 +445,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", dof_names_levels[1]);
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_levels_gradient[1]);
+    setSumFactorization(*p);
     
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -470,6 +485,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", "KineticEnergy");
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", "KineticEnergy_gradient");
+    setSumFactorization(*p);
   
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -598,6 +614,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Variable Name"            ,   "Pressure");
       p->set<string>("Gradient BF Name"    ,   "Grad BF");
       p->set<string>("Gradient Variable Name",   "Gradient QP Pressure");
+      setSumFactorization(*p);
     
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
@@ -748,6 +765,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Variable Name",          "GeoPotential");
       p->set<string>("Gradient BF Name",       "Grad BF");
       p->set<string>("Gradient Variable Name", "Gradient QP GeoPotential");
+      setSumFactorization(*p);
     
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
@@ -869,6 +887,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Variable Name", dof_names_tracers[t]);
       p->set<string>("Gradient BF Name", "Grad BF");
       p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
+      setSumFactorization(*p);
     
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
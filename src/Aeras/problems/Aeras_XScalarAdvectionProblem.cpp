@@ -118,6 +118,7 @@ Aeras::XScalarAdvectionProblem::constructDirichletEvaluators(
                                         this->params,
                                         this->paramLib);
    offsets_ = dirUtils.getOffsets();
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -133,6 +133,7 @@ Aeras::XZHydrostaticProblem::constructDirichletEvaluators(
                                         this->params,
                                         this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -7,6 +7,7 @@
 
 #include "Albany_Application.hpp"
 #include "Albany_Utils.hpp"
+#include "Albany_Memory.hpp"
 #include "AAdapt_RC_Manager.hpp"
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_DiscretizationFactory.hpp"
@@ -15,6 +16,7 @@
 #include "Stokhos_OrthogPolyBasis.hpp"
 #endif
 #include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "Epetra_LocalMap.h"
@@ -25,6 +27,7 @@
 #endif
 
 #include<string>
+#include<algorithm>
 #include "Albany_DataTypes.hpp"
 
 #include "Albany_DummyParameterAccessor.hpp"
@@ -83,6 +86,14 @@ double previous_time;
 
 extern bool TpetraBuild;
 
+namespace {
+// Storage of a CrsMatrix: values and column indices, plus row offsets.
+double crsMatrixBytes (const Tpetra_CrsMatrix& A) {
+  return static_cast<double>(A.getNodeNumEntries())*(sizeof(ST) + sizeof(LO))
+    + static_cast<double>(A.getNodeNumRows() + 1)*sizeof(size_t);
+}
+} // namespace
+
 Albany::Application::
 Application(const RCP<const Teuchos_Comm>& comm_,
     const RCP<Teuchos::ParameterList>& params,
@@ -92,6 +103,8 @@ Application(const RCP<const Teuchos_Comm>& comm_,
     physicsBasedPreconditioner(false),
     shapeParamsHaveBeenReset(false),
     morphFromInit(true), perturbBetaForDirichlets(0.0),
+    cacheLinearJacobian(false), assemblingLinearCache(false),
+    firstJacobianFill(true),
     phxGraphVisDetail(0),
     stateGraphVisDetail(0),
     params_(params), 
@@ -118,6 +131,8 @@ Application(const RCP<const Teuchos_Comm>& comm_) :
     physicsBasedPreconditioner(false),
     shapeParamsHaveBeenReset(false),
     morphFromInit(true), perturbBetaForDirichlets(0.0),
+    cacheLinearJacobian(false), assemblingLinearCache(false),
+    firstJacobianFill(true),
     phxGraphVisDetail(0),
     stateGraphVisDetail(0),
     requires_sdbcs_(false), 
@@ -908,6 +923,10 @@ void Albany::Application::finalSetUp(
 
   perturbBetaForDirichlets = problemParams->get("Perturb Dirichlet", 0.0);
 
+  // The cache is kept on the Jacobian graph, which Epetra fills rebuild on
+  // every call
+  cacheLinearJacobian = problem->isLinear() && TpetraBuild;
+
   is_adjoint =
       problemParams->get("Solve Adjoint", false);
 
@@ -1821,6 +1840,18 @@ computeGlobalJacobianImplT(const double alpha,
 {
   TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
 
+  Teuchos::RCP<MemoryPhase> first_fill_phase;
+  if (firstJacobianFill) {
+    first_fill_phase = Teuchos::rcp(new MemoryPhase("First Fill"));
+    firstJacobianFill = false;
+  }
+
+  if (cacheLinearJacobian && !assemblingLinearCache && scale == 1.0) {
+    computeLinearJacobianT(alpha, beta, omega, current_time, xdotT, xdotdotT,
+                           xT, p, fT, jacT);
+    return;
+  }
+
   postRegSetup("Jacobian");
 
   // Load connectivity map and coordinates
@@ -1911,6 +1942,11 @@ computeGlobalJacobianImplT(const double alpha,
     workset.JacT = overlapped_jacT;
     loadWorksetJacobianInfo(workset, alpha, beta, omega);
 
+    // Rows replaced by DBCs below are not assembled, unless the scaling has
+    // to read them first or the Dirichlet conditions are applied later
+    if (Teuchos::nonnull(dfm) && !assemblingLinearCache && scale == 1.0)
+      workset.dirichletRows = getDirichletRows();
+
     //fill Jacobian derivative dimensions:
     for (int ps = 0; ps < fm.size(); ps++) {
       (workset.Jacobian_deriv_dims).push_back(
@@ -2005,6 +2041,180 @@ computeGlobalJacobianImplT(const double alpha,
     }
   } // End timer
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
+  if (!assemblingLinearCache)
+    applyDirichletJacobianT(alpha, beta, omega, current_time, xdotT, xdotdotT,
+                            xT, fT, jacT);
+  jacT->fillComplete();
+
+  //Apply scaling to residual and Jacobian
+  if (scaleBCdofs == true) {
+    if (Teuchos::nonnull(fT))
+      fT->elementWiseMultiply(1.0, *scaleVec_, *fT, 0.0);
+    jacT->leftScale(*scaleVec_);
+  }
+
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  if (overlapped_jacT->isFillActive()) {
+    // Makes getLocalMatrix() valid.
+    overlapped_jacT->fillComplete();
+  }
+#endif
+  if (derivatives_check_ > 0 && !assemblingLinearCache)
+    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
+        derivatives_check_);
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled()) {
+    mt.setComponentBytes("Jacobian (owned)", crsMatrixBytes(*jacT));
+    mt.setComponentBytes("Jacobian (overlapped)",
+                         crsMatrixBytes(*overlapped_jacT));
+  }
+}
+
+void
+Albany::Application::
+computeLinearJacobianT(const double alpha,
+    const double beta,
+    const double omega,
+    const double current_time,
+    const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+    const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+    const Teuchos::RCP<const Tpetra_Vector>& xT,
+    const Teuchos::Array<ParamVec>& p,
+    const Teuchos::RCP<Tpetra_Vector>& fT,
+    const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
+{
+  const Teuchos::RCP<const Tpetra_CrsGraph> graphT = jacT->getCrsGraph();
+
+  // The cached matrices hold for the graph (i.e. the mesh) and the parameter
+  // and distributed parameter values they were assembled with
+  Teuchos::Array<RealType> paramValues;
+  for (int i = 0; i < p.size(); i++)
+    for (unsigned int j = 0; j < p[i].size(); j++)
+      paramValues.push_back(p[i][j].baseValue);
+
+  int localDistParamsChanged = 0, distParamsChanged = 0;
+  std::size_t numDistParams = 0;
+  for (DistParamLib::const_iterator it = distParamLib->begin();
+       it != distParamLib->end(); ++it, ++numDistParams) {
+    const Teuchos::RCP<const Tpetra_Vector> valuesT = it->second->vector();
+    const std::map<std::string, Teuchos::RCP<Tpetra_Vector> >::const_iterator
+      cached = linearDistParamValues.find(it->first);
+    if (cached == linearDistParamValues.end() ||
+        cached->second->getLocalLength() != valuesT->getLocalLength()) {
+      localDistParamsChanged = 1;
+      continue;
+    }
+    const Teuchos::ArrayRCP<const ST> values = valuesT->get1dView();
+    const Teuchos::ArrayRCP<const ST> cachedValues =
+      cached->second->get1dView();
+    if (!std::equal(values.begin(), values.end(), cachedValues.begin()))
+      localDistParamsChanged = 1;
+  }
+  if (numDistParams != linearDistParamValues.size())
+    localDistParamsChanged = 1;
+  // Reassembly is collective, so decide it together
+  Teuchos::reduceAll<int, int>(*commT, Teuchos::REDUCE_MAX,
+      localDistParamsChanged, Teuchos::outArg(distParamsChanged));
+
+  if (Teuchos::is_null(linearKT) || linearKT->getCrsGraph() != graphT ||
+      paramValues != linearParamValues || distParamsChanged) {
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Linear Jacobian Assembly");
+    TEUCHOS_TEST_FOR_EXCEPTION(!graphT->isFillComplete(), std::logic_error,
+        "Error in Albany::Application: \"Linear Problem\" requires a "
+        "Jacobian built on the fill-complete discretization graph.\n");
+
+    linearKT = Teuchos::rcp(new Tpetra_CrsMatrix(graphT));
+    linearMT = num_time_deriv > 0 ?
+        Teuchos::rcp(new Tpetra_CrsMatrix(graphT)) : Teuchos::null;
+    linearNT = num_time_deriv > 1 ?
+        Teuchos::rcp(new Tpetra_CrsMatrix(graphT)) : Teuchos::null;
+
+    assemblingLinearCache = true;
+    computeGlobalJacobianImplT(0.0, 1.0, 0.0, current_time, xdotT, xdotdotT,
+                               xT, p, Teuchos::null, linearKT);
+    if (Teuchos::nonnull(linearMT))
+      computeGlobalJacobianImplT(1.0, 0.0, 0.0, current_time, xdotT, xdotdotT,
+                                 xT, p, Teuchos::null, linearMT);
+    if (Teuchos::nonnull(linearNT))
+      computeGlobalJacobianImplT(0.0, 0.0, 1.0, current_time, xdotT, xdotdotT,
+                                 xT, p, Teuchos::null, linearNT);
+    assemblingLinearCache = false;
+
+    linearParamValues = paramValues;
+    linearDistParamValues.clear();
+    for (DistParamLib::const_iterator it = distParamLib->begin();
+         it != distParamLib->end(); ++it)
+      linearDistParamValues[it->first] =
+        Teuchos::rcp(new Tpetra_Vector(*it->second->vector(), Teuchos::Copy));
+  }
+
+  // Sources and Neumann data may still depend on time and parameters, so the
+  // residual comes from a (cheap) residual fill
+  if (Teuchos::nonnull(fT))
+    computeGlobalResidualImplT(current_time, xdotT, xdotdotT, xT, p, fT);
+
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Linear Jacobian Update");
+
+    // All the matrices share the graph of jacT, so each row of
+    // beta*K + alpha*M + omega*N is a plain axpy of the value arrays
+    jacT->resumeFill();
+    Teuchos::Array<ST> vals(jacT->getNodeMaxNumRowEntries());
+    Teuchos::ArrayView<const LO> cols, termCols;
+    Teuchos::ArrayView<const ST> termVals;
+    const LO numRows = jacT->getNodeNumRows();
+    for (LO row = 0; row < numRows; ++row) {
+      linearKT->getLocalRowView(row, cols, termVals);
+      const int numEntries = cols.size();
+      for (int i = 0; i < numEntries; ++i)
+        vals[i] = beta * termVals[i];
+      if (Teuchos::nonnull(linearMT) && alpha != 0.0) {
+        linearMT->getLocalRowView(row, termCols, termVals);
+        for (int i = 0; i < numEntries; ++i)
+          vals[i] += alpha * termVals[i];
+      }
+      if (Teuchos::nonnull(linearNT) && omega != 0.0) {
+        linearNT->getLocalRowView(row, termCols, termVals);
+        for (int i = 0; i < numEntries; ++i)
+          vals[i] += omega * termVals[i];
+      }
+      jacT->replaceLocalValues(row, cols, vals(0, numEntries));
+    }
+  }
+
+  applyDirichletJacobianT(alpha, beta, omega, current_time, xdotT, xdotdotT,
+                          xT, fT, jacT);
+  jacT->fillComplete();
+
+  if (derivatives_check_ > 0)
+    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
+        derivatives_check_);
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled()) {
+    mt.setComponentBytes("Jacobian (owned)", crsMatrixBytes(*jacT));
+    mt.setComponentBytes("Jacobian (overlapped)",
+                         crsMatrixBytes(*solMgrT->get_overlapped_jacT()));
+    double cacheBytes = crsMatrixBytes(*linearKT);
+    if (Teuchos::nonnull(linearMT)) cacheBytes += crsMatrixBytes(*linearMT);
+    if (Teuchos::nonnull(linearNT)) cacheBytes += crsMatrixBytes(*linearNT);
+    mt.setComponentBytes("Linear Jacobian Cache", cacheBytes);
+  }
+}
+
+void
+Albany::Application::
+applyDirichletJacobianT(const double alpha,
+    const double beta,
+    const double omega,
+    const double current_time,
+    const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+    const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+    const Teuchos::RCP<const Tpetra_Vector>& xT,
+    const Teuchos::RCP<Tpetra_Vector>& fT,
+    const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
+{
   if (Teuchos::nonnull(dfm)) {
     PHAL::Workset workset;
 
@@ -2048,24 +2258,6 @@ computeGlobalJacobianImplT(const double alpha,
     // FillType template argument used to specialize Sacado
     dfm->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
   }
-  jacT->fillComplete();
-
-  //Apply scaling to residual and Jacobian
-  if (scaleBCdofs == true) {
-    if (Teuchos::nonnull(fT))
-      fT->elementWiseMultiply(1.0, *scaleVec_, *fT, 0.0);
-    jacT->leftScale(*scaleVec_);
-  }
-
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-#endif
-  if (derivatives_check_ > 0)
-    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
-        derivatives_check_);
 }
 
 #if defined(ALBANY_EPETRA)
@@ -5184,20 +5376,16 @@ void Albany::Application::setScale(Teuchos::RCP<Tpetra_CrsMatrix> jacT)
 void Albany::Application::setScaleBCDofs(PHAL::Workset& workset)
 {
   scaleVec_->putScalar(1.0);
+  Teuchos::ArrayRCP<ST> scaleVec_view = scaleVec_->get1dViewNonConst();
   int l = 0;
   for (auto iterator = workset.nodeSets->begin();
       iterator != workset.nodeSets->end(); iterator++)
       {
     //std::cout << "key: " << iterator->first <<  std::endl;
-    const std::vector<std::vector<int>>& nsNodes = iterator->second;
-    for (unsigned int i = 0; i < nsNodes.size(); i++) {
-      //std::cout << "l, offsets size: " << l << ", " << offsets_[l].size() << std::endl;
-      for (unsigned j = 0; j < offsets_[l].size(); j++) {
-        int lunk = nsNodes[i][offsets_[l][j]];
-        //std::cout << "l, j, i, offsets_: " << l << ", " << j << ", " << i << ", " << offsets_[l][j] << std::endl;
-        //std::cout << "lunk = " << lunk << std::endl;
-        scaleVec_->replaceLocalValue(lunk, scale);
-      }
+    for (unsigned j = 0; j < offsets_[l].size(); j++) {
+      const std::vector<LO>& dofs = disc->getNodeSetDofs(iterator->first, offsets_[l][j]);
+      for (unsigned int i = 0; i < dofs.size(); i++)
+        scaleVec_view[dofs[i]] = scale;
     }
     l++;
   }
@@ -5220,15 +5408,10 @@ void Albany::Application::setScaleBCDofs(PHAL::Workset& workset)
           iterator != sd->getNodeSets().end(); iterator++)
           {
         //std::cout << "key: " << iterator->first <<  std::endl;
-        const std::vector<std::vector<int>>& nsNodes = iterator->second;
-        for (unsigned int i = 0; i < nsNodes.size(); i++) {
-          //std::cout << "l, offsets size: " << l << ", " << offsets_[l].size() << std::endl;
-          for (unsigned j = 0; j < offsets_[l].size(); j++) {
-            int lunk = nsNodes[i][offsets_[l][j]];
-            //std::cout << "l, j, i, offsets_: " << l << ", " << j << ", " << i << ", " << offsets_[l][j] << std::endl;
-            //std::cout << "lunk = " << lunk << std::endl;
-            scaleVec_->replaceLocalValue(lunk, scale);
-          }
+        for (unsigned j = 0; j < offsets_[l].size(); j++) {
+          const std::vector<LO>& dofs = sd->getNodeSetDofs(iterator->first, offsets_[l][j]);
+          for (unsigned int i = 0; i < dofs.size(); i++)
+            scaleVec_view[dofs[i]] = scale;
         }
         l++;
       }
@@ -5238,6 +5421,46 @@ void Albany::Application::setScaleBCDofs(PHAL::Workset& workset)
   //scaleVec_->describe(*out, Teuchos::VERB_EXTREME);
 }
 
+Teuchos::RCP<const PHAL::DofMask> Albany::Application::getDirichletRows()
+{
+  const Teuchos::RCP<const Tpetra_Map> overlapMapT = disc->getOverlapMapT();
+  if (dirichletRowsMap_ == overlapMapT)
+    return dirichletRows_;
+
+  dirichletRowsMap_ = overlapMapT;
+  dirichletRows_ = Teuchos::null;
+  const std::map<std::string, std::vector<int>>& rowOffsets =
+      problem->getDirichletRowOffsets();
+  if (rowOffsets.empty())
+    return dirichletRows_;
+
+  // The DBCs replace owned rows, but an element sums into overlapped rows
+  // owned by other ranks too, so the owned rows are imported
+  Tpetra_Vector ownedRowsT(disc->getMapT(), true);
+  {
+    Teuchos::ArrayRCP<ST> ownedRowsT_view = ownedRowsT.get1dViewNonConst();
+    const auto& nodeSets = disc->getNodeSets();
+    for (auto it = rowOffsets.begin(); it != rowOffsets.end(); ++it) {
+      if (nodeSets.find(it->first) == nodeSets.end()) continue;
+      for (unsigned j = 0; j < it->second.size(); j++) {
+        const std::vector<LO>& dofs = disc->getNodeSetDofs(it->first, it->second[j]);
+        for (unsigned int i = 0; i < dofs.size(); i++)
+          ownedRowsT_view[dofs[i]] = 1.0;
+      }
+    }
+  }
+  Tpetra_Vector overlapRowsT(overlapMapT);
+  Tpetra_Import importerT(disc->getMapT(), overlapMapT);
+  overlapRowsT.doImport(ownedRowsT, importerT, Tpetra::INSERT);
+
+  Teuchos::RCP<PHAL::DofMask> rows = Teuchos::rcp(new PHAL::DofMask);
+  Teuchos::ArrayRCP<const ST> overlapRowsT_view = overlapRowsT.get1dView();
+  for (LO i = 0; i < overlapRowsT_view.size(); i++)
+    if (overlapRowsT_view[i] != 0.0) rows->insert(i);
+  dirichletRows_ = rows;
+  return dirichletRows_;
+}
+
 void Albany::Application::loadWorksetSidesetInfo(
     PHAL::Workset& workset,
     const int ws)
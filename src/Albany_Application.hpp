@@ -281,6 +281,30 @@ namespace Albany {
                                      const Teuchos::RCP<Tpetra_Vector>& fT,
                                      const Teuchos::RCP<Tpetra_CrsMatrix>& jacT);
 
+     //! Jacobian of a linear problem formed from the cached stiffness and
+     //! mass matrices, which are (re)assembled when needed
+     void computeLinearJacobianT(const double alpha,
+                                 const double beta,
+                                 const double omega,
+                                 const double current_time,
+                                 const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                 const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                 const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                 const Teuchos::Array<ParamVec>& p,
+                                 const Teuchos::RCP<Tpetra_Vector>& fT,
+                                 const Teuchos::RCP<Tpetra_CrsMatrix>& jacT);
+
+     //! Apply the Dirichlet field manager to an exported Jacobian
+     void applyDirichletJacobianT(const double alpha,
+                                  const double beta,
+                                  const double omega,
+                                  const double current_time,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xdotT,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xdotdotT,
+                                  const Teuchos::RCP<const Tpetra_Vector>& xT,
+                                  const Teuchos::RCP<Tpetra_Vector>& fT,
+                                  const Teuchos::RCP<Tpetra_CrsMatrix>& jacT);
+
   public:
 
     //! Compute global Preconditioner
@@ -819,6 +843,10 @@ namespace Albany {
     void setScale(Teuchos::RCP<Tpetra_CrsMatrix> jacT = Teuchos::null); 
     void setScaleBCDofs(PHAL::Workset& workset);  
 
+    //! Overlapped rows that the Dirichlet field manager replaces entirely,
+    //  rebuilt when the discretization changes; null if there are none
+    Teuchos::RCP<const PHAL::DofMask> getDirichletRows();
+
 #if defined(ALBANY_EPETRA)
     void setupBasicWorksetInfo(
       PHAL::Workset& workset,
@@ -1249,6 +1277,19 @@ namespace Albany {
     //  conditions, optionally add a small perturbation to the diag
     double perturbBetaForDirichlets;
 
+    //! Linear problems: dF/dx, dF/dxdot and dF/dxdotdot without Dirichlet
+    //  conditions, the parameter and distributed parameter values they were
+    //  assembled with, and whether they are being assembled
+    bool cacheLinearJacobian;
+    bool assemblingLinearCache;
+    Teuchos::RCP<Tpetra_CrsMatrix> linearKT, linearMT, linearNT;
+    Teuchos::Array<RealType> linearParamValues;
+    std::map<std::string, Teuchos::RCP<Tpetra_Vector> > linearDistParamValues;
+
+    //! The first Jacobian fill allocates most evaluator storage; it is
+    //  recorded as its own memory phase
+    bool firstJacobianFill;
+
     void determinePiroSolver(const Teuchos::RCP<Teuchos::ParameterList>& topLevelParams);
 
 #ifdef ALBANY_MOR
@@ -1265,6 +1306,11 @@ namespace Albany {
     Teuchos::Array<Teuchos::Array<int>> offsets_;
     Teuchos::RCP<Tpetra_Vector> scaleVec_;  
 
+    //! Overlapped rows replaced by constant DBCs, and the overlap map they
+    //  were found for
+    Teuchos::RCP<const PHAL::DofMask> dirichletRows_;
+    Teuchos::RCP<const Tpetra_Map> dirichletRowsMap_;
+
     //boolean read from input file telling code whether to compute/print responses every step 
     bool observe_responses; 
     
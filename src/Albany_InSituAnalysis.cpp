@@ -0,0 +1,422 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_InSituAnalysis.hpp"
+
+#include "Albany_AbstractMeshStruct.hpp"
+#include "Albany_StateInfoStruct.hpp"
+
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+
+namespace Albany {
+
+namespace {
+
+std::map<std::string, InSituPluginFactory>& registry () {
+  static std::map<std::string, InSituPluginFactory> factories;
+  return factories;
+}
+
+// Appends one row per observation to the output file on rank 0.
+class Writer {
+public:
+  Writer (const Teuchos::ParameterList& p, const std::string& defaultName,
+          const Teuchos::RCP<const Teuchos_Comm>& comm)
+    : first_(true), rank0_(comm->getRank() == 0)
+  {
+    const std::string format = p.get<std::string>("Output Format", "CSV");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      format != "CSV" && format != "Binary", std::logic_error,
+      "In Situ Analysis: unknown Output Format \"" << format
+      << "\"; valid values are \"CSV\" and \"Binary\".\n");
+    binary_ = format == "Binary";
+    filename_ = p.get<std::string>(
+      "Output File", defaultName + (binary_ ? ".bin" : ".csv"));
+  }
+
+  void write (const double stamp, const std::vector<std::string>& header,
+              const std::vector<double>& values) {
+    if (!rank0_) return;
+    std::ios::openmode mode = first_ ? std::ios::trunc : std::ios::app;
+    if (binary_) {
+      std::ofstream f(filename_.c_str(), mode | std::ios::binary);
+      f.write(reinterpret_cast<const char*>(&stamp), sizeof(double));
+      f.write(reinterpret_cast<const char*>(values.data()),
+              values.size()*sizeof(double));
+    } else {
+      std::ofstream f(filename_.c_str(), mode);
+      f << std::setprecision(10);
+      if (first_) {
+        f << "stamp";
+        for (std::size_t i = 0; i < header.size(); ++i) f << "," << header[i];
+        f << "\n";
+      }
+      f << stamp;
+      for (std::size_t i = 0; i < values.size(); ++i) f << "," << values[i];
+      f << "\n";
+    }
+    first_ = false;
+  }
+
+private:
+  std::string filename_;
+  bool binary_, first_, rank0_;
+};
+
+// Calls f(blockName, value) for every owned value of a state or, if field is
+// "Solution", of a solution component. Returns false if this rank has no
+// such state. Nodal state arrays hold the owned nodes only, so a node shared
+// between ranks is visited once, on its owner.
+template <typename Functor>
+bool forEachValue (const InSituData& d, const std::string& field,
+                   const int component, Functor f) {
+  if (field == "Solution") {
+    const Teuchos::ArrayRCP<const ST> x = d.solution->getData();
+    for (int i = component; i < x.size(); i += d.numEq)
+      f(std::string(), x[i]);
+    return true;
+  }
+  bool found = false;
+  const StateArrayVec* arrays[] = {&d.states->elemStateArrays,
+                                   &d.states->nodeStateArrays};
+  for (int k = 0; k < 2; ++k) {
+    for (std::size_t ws = 0; ws < arrays[k]->size(); ++ws) {
+      StateArray::const_iterator it = (*arrays[k])[ws].find(field);
+      if (it == (*arrays[k])[ws].end()) continue;
+      found = true;
+      const std::string& block = k == 0 ? (*d.wsEBNames)[ws] : std::string();
+      const double* v = it->second.contiguous_data();
+      for (int i = 0; i < it->second.size(); ++i) f(block, v[i]);
+    }
+    if (found) break;
+  }
+  return found;
+}
+
+// True on all ranks if some rank holds field as a nodal state.
+bool isNodalState (const InSituData& d, const std::string& field) {
+  int local = 0, global = 0;
+  const StateArrayVec& arrays = d.states->nodeStateArrays;
+  for (std::size_t ws = 0; ws < arrays.size(); ++ws)
+    if (arrays[ws].find(field) != arrays[ws].end()) local = 1;
+  Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MAX, local, Teuchos::ptr(&global));
+  return global != 0;
+}
+
+void checkFieldExists (const InSituData& d, const std::string& field,
+                       const bool found) {
+  int local = found ? 1 : 0, global = 0;
+  Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MAX, local, Teuchos::ptr(&global));
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    global == 0, std::logic_error,
+    "In Situ Analysis: no state named \"" << field << "\".\n");
+}
+
+class Histogram : public InSituPlugin {
+public:
+  Histogram (const Teuchos::ParameterList& p,
+             const Teuchos::RCP<const Teuchos_Comm>& comm)
+    : writer_(p, p.name(), comm)
+  {
+    field_ = p.get<std::string>("Field");
+    component_ = p.get<int>("Component", 0);
+    numBins_ = p.get<int>("Number of Bins", 10);
+    const Teuchos::Array<double> range =
+      p.get<Teuchos::Array<double> >("Range");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      numBins_ < 1 || range.size() != 2 || !(range[0] < range[1]),
+      std::logic_error, "In Situ Analysis: Histogram \"" << p.name()
+      << "\" needs Number of Bins > 0 and an increasing Range {min, max}.\n");
+    lo_ = range[0];
+    hi_ = range[1];
+    const double w = (hi_ - lo_)/numBins_;
+    for (int b = 0; b < numBins_; ++b) {
+      std::ostringstream os;
+      os << lo_ + (b + 0.5)*w;
+      header_.push_back(os.str());
+    }
+  }
+
+  // Values outside Range are counted in the first or last bin.
+  void analyze (const InSituData& d) {
+    std::vector<double> local(numBins_, 0.0), global(numBins_, 0.0);
+    const double scale = numBins_/(hi_ - lo_);
+    const int last = numBins_ - 1;
+    const bool found = forEachValue(
+      d, field_, component_, [&](const std::string&, const double v) {
+        const int b = static_cast<int>((v - lo_)*scale);
+        local[std::min(std::max(b, 0), last)] += 1.0;
+      });
+    if (d.step == 0) checkFieldExists(d, field_, found);
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_SUM, numBins_,
+                       local.data(), global.data());
+    writer_.write(d.stamp, header_, global);
+  }
+
+private:
+  Writer writer_;
+  std::string field_;
+  int component_, numBins_;
+  double lo_, hi_;
+  std::vector<std::string> header_;
+};
+
+class BlockMinMax : public InSituPlugin {
+public:
+  BlockMinMax (const Teuchos::ParameterList& p,
+               const Teuchos::RCP<const Teuchos_Comm>& comm)
+    : writer_(p, p.name(), comm)
+  {
+    field_ = p.get<std::string>("Field");
+    component_ = p.get<int>("Component", 0);
+  }
+
+  void analyze (const InSituData& d) {
+    // Nodal state arrays are stored by node bucket, not by element block, so
+    // their values cannot be attributed to blocks.
+    if (d.step == 0 && field_ != "Solution")
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        isNodalState(d, field_), std::logic_error,
+        "In Situ Analysis: Block Min Max needs an element state or"
+        " "Solution", but "" << field_ << "" is a nodal state.\n");
+
+    const int nb = d.blockNames.size();
+    if (header_.empty())
+      for (int b = 0; b < nb; ++b) {
+        header_.push_back(d.blockNames[b] + " min");
+        header_.push_back(d.blockNames[b] + " max");
+      }
+
+    std::map<std::string, int> blockIndex;
+    for (int b = 0; b < nb; ++b) blockIndex[d.blockNames[b]] = b;
+    std::vector<double> minLocal(nb, std::numeric_limits<double>::max());
+    std::vector<double> maxLocal(nb, -std::numeric_limits<double>::max());
+    bool found = false;
+    if (field_ == "Solution") {
+      // Walk the element connectivity so that each node is attributed to the
+      // blocks it belongs to.
+      const Teuchos::ArrayRCP<const ST> x = d.overlappedSolution->getData();
+      const AbstractDiscretization::Conn& conn = *d.wsElNodeEqID;
+      for (std::size_t ws = 0; ws < conn.size(); ++ws) {
+        const int b = blockIndex[(*d.wsEBNames)[ws]];
+        for (int cell = 0; cell < conn[ws].dimension(0); ++cell)
+          for (int node = 0; node < conn[ws].dimension(1); ++node) {
+            const double v = x[conn[ws](cell, node, component_)];
+            minLocal[b] = std::min(minLocal[b], v);
+            maxLocal[b] = std::max(maxLocal[b], v);
+          }
+      }
+      found = true;
+    } else {
+      found = forEachValue(
+        d, field_, component_, [&](const std::string& block, const double v) {
+          std::map<std::string, int>::const_iterator it = blockIndex.find(block);
+          if (it == blockIndex.end()) return;
+          minLocal[it->second] = std::min(minLocal[it->second], v);
+          maxLocal[it->second] = std::max(maxLocal[it->second], v);
+        });
+    }
+    if (d.step == 0) checkFieldExists(d, field_, found);
+
+    std::vector<double> minGlobal(nb), maxGlobal(nb), values(2*nb);
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MIN, nb,
+                       minLocal.data(), minGlobal.data());
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MAX, nb,
+                       maxLocal.data(), maxGlobal.data());
+    for (int b = 0; b < nb; ++b) {
+      values[2*b] = minGlobal[b];
+      values[2*b + 1] = maxGlobal[b];
+    }
+    writer_.write(d.stamp, header_, values);
+  }
+
+private:
+  Writer writer_;
+  std::string field_;
+  int component_;
+  std::vector<std::string> header_;
+};
+
+class ProbeLine : public InSituPlugin {
+public:
+  ProbeLine (const Teuchos::ParameterList& p,
+             const Teuchos::RCP<const Teuchos_Comm>& comm)
+    : writer_(p, p.name(), comm), coordsPtr_(0), coordsSize_(-1)
+  {
+    component_ = p.get<int>("Component", 0);
+    numPoints_ = p.get<int>("Number of Points", 10);
+    start_ = p.get<Teuchos::Array<double> >("Start");
+    end_ = p.get<Teuchos::Array<double> >("End");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      numPoints_ < 1 || start_.size() != end_.size(), std::logic_error,
+      "In Situ Analysis: Probe Line \"" << p.name()
+      << "\" needs Number of Points > 0 and Start and End of equal size.\n");
+    for (int i = 0; i < numPoints_; ++i) {
+      std::ostringstream os;
+      os << "p" << i;
+      header_.push_back(os.str());
+    }
+  }
+
+  void analyze (const InSituData& d) {
+    // The closest node of each point is found once and again only when the
+    // mesh changes on some rank; locate is collective, so all ranks decide
+    // together.
+    int localChanged = (d.coordinates->getRawPtr() != coordsPtr_ ||
+                        d.coordinates->size() != coordsSize_) ? 1 : 0;
+    int changed = 0;
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MAX, localChanged,
+                       Teuchos::ptr(&changed));
+    if (changed) locate(d);
+
+    const Teuchos::ArrayRCP<const ST> x = d.overlappedSolution->getData();
+    std::vector<double> local(numPoints_, 0.0), global(numPoints_, 0.0);
+    for (int i = 0; i < numPoints_; ++i)
+      if (nodes_[i] >= 0) local[i] = x[nodes_[i]*d.numEq + component_];
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_SUM, numPoints_,
+                       local.data(), global.data());
+    writer_.write(d.stamp, header_, global);
+  }
+
+private:
+  void locate (const InSituData& d) {
+    const Teuchos::ArrayRCP<double>& coords = *d.coordinates;
+    const int dim = d.numDims;
+    const int numNodes = coords.size()/dim;
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      start_.size() != dim ||
+      d.overlappedSolution->getLocalLength() != numNodes*d.numEq,
+      std::logic_error, "In Situ Analysis: Probe Line needs Start and End of"
+      " the mesh dimension and a nodal solution.\n");
+
+    std::vector<double> dist(numPoints_), minDist(numPoints_);
+    std::vector<int> closest(numPoints_, -1);
+    for (int i = 0; i < numPoints_; ++i) {
+      const double t = numPoints_ > 1 ? double(i)/(numPoints_ - 1) : 0.0;
+      dist[i] = std::numeric_limits<double>::max();
+      for (int n = 0; n < numNodes; ++n) {
+        double r2 = 0.0;
+        for (int j = 0; j < dim; ++j) {
+          const double dx = coords[n*dim + j] - (start_[j] + t*(end_[j] - start_[j]));
+          r2 += dx*dx;
+        }
+        if (r2 < dist[i]) {
+          dist[i] = r2;
+          closest[i] = n;
+        }
+      }
+    }
+
+    // The lowest rank among those holding the closest node provides the value.
+    const int rank = d.comm->getRank(), size = d.comm->getSize();
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MIN, numPoints_,
+                       dist.data(), minDist.data());
+    std::vector<int> candidate(numPoints_), owner(numPoints_);
+    for (int i = 0; i < numPoints_; ++i)
+      candidate[i] = closest[i] >= 0 && dist[i] == minDist[i] ? rank : size;
+    Teuchos::reduceAll(*d.comm, Teuchos::REDUCE_MIN, numPoints_,
+                       candidate.data(), owner.data());
+    nodes_.assign(numPoints_, -1);
+    for (int i = 0; i < numPoints_; ++i)
+      if (owner[i] == rank) nodes_[i] = closest[i];
+
+    coordsPtr_ = coords.getRawPtr();
+    coordsSize_ = coords.size();
+  }
+
+  Writer writer_;
+  int component_, numPoints_;
+  Teuchos::Array<double> start_, end_;
+  std::vector<std::string> header_;
+  std::vector<int> nodes_;
+  const double* coordsPtr_;
+  int coordsSize_;
+};
+
+template <typename Plugin>
+Teuchos::RCP<InSituPlugin> create (
+  const Teuchos::ParameterList& p, const Teuchos::RCP<const Teuchos_Comm>& comm)
+{
+  return Teuchos::rcp(new Plugin(p, comm));
+}
+
+void registerBuiltins () {
+  static bool registered = false;
+  if (registered) return;
+  registered = true;
+  registry()["Histogram"] = &create<Histogram>;
+  registry()["Block Min Max"] = &create<BlockMinMax>;
+  registry()["Probe Line"] = &create<ProbeLine>;
+}
+
+} // namespace
+
+void InSituAnalysis::registerPlugin (
+  const std::string& type, InSituPluginFactory factory)
+{
+  registerBuiltins();
+  registry()[type] = factory;
+}
+
+InSituAnalysis::InSituAnalysis (
+  const Teuchos::ParameterList& params,
+  const Teuchos::RCP<const Teuchos_Comm>& comm)
+  : comm_(comm), step_(0)
+{
+  registerBuiltins();
+  for (Teuchos::ParameterList::ConstIterator it = params.begin();
+       it != params.end(); ++it) {
+    if (!params.isSublist(params.name(it))) continue;
+    const Teuchos::ParameterList& p = params.sublist(params.name(it));
+    const std::string type = p.get<std::string>("Type");
+    std::map<std::string, InSituPluginFactory>::const_iterator f =
+      registry().find(type);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      f == registry().end(), std::logic_error,
+      "In Situ Analysis: unknown Type \"" << type << "\" in \""
+      << params.name(it) << "\".\n");
+    plugins_.push_back(f->second(p, comm));
+    intervals_.push_back(std::max(1, p.get<int>("Interval", 1)));
+  }
+}
+
+void InSituAnalysis::observe (
+  const double stamp, const Tpetra_Vector& solution,
+  const Tpetra_Vector& overlappedSolution, AbstractDiscretization& disc)
+{
+  Teuchos::TimeMonitor timer(
+    *Teuchos::TimeMonitor::getNewTimer("Albany: In Situ Analysis"));
+  InSituData d;
+  d.stamp = stamp;
+  d.step = step_;
+  d.solution = &solution;
+  d.overlappedSolution = &overlappedSolution;
+  d.numEq = disc.getNumEq();
+  d.numDims = disc.getNumDim();
+  d.states = &disc.getStateArrays();
+  d.wsElNodeEqID = &disc.getWsElNodeEqID();
+  d.wsEBNames = &disc.getWsEBNames();
+  const Teuchos::ArrayRCP<Teuchos::RCP<MeshSpecsStruct> >& ms =
+    disc.getMeshStruct()->getMeshSpecs();
+  for (int i = 0; i < ms.size(); ++i) d.blockNames.push_back(ms[i]->ebName);
+  d.coordinates = &disc.getCoordinates();
+  d.comm = comm_;
+
+  for (std::size_t i = 0; i < plugins_.size(); ++i)
+    if (step_ % intervals_[i] == 0) plugins_[i]->analyze(d);
+  ++step_;
+}
+
+} // namespace Albany
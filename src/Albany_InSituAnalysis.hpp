@@ -0,0 +1,131 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_INSITUANALYSIS_HPP
+#define ALBANY_INSITUANALYSIS_HPP
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractDiscretization.hpp"
+
+namespace Albany {
+
+/*! \brief Views of the current solution and mesh data handed to in-situ
+ *         analysis plugins.
+ *
+ *  Nothing is copied: the members refer to the observer's vectors and to the
+ *  discretization's own arrays, and are valid only during the call to
+ *  InSituPlugin::analyze.
+ */
+struct InSituData {
+  //! Time (or continuation parameter) and number of the observation.
+  double stamp;
+  int step;
+
+  //! Owned and overlapped solution.
+  const Tpetra_Vector* solution;
+  const Tpetra_Vector* overlappedSolution;
+
+  //! Number of equations per node and spatial dimension.
+  int numEq;
+  int numDims;
+
+  //! Element and nodal state arrays, indexed by workset. They hold owned
+  //! elements and owned nodes only.
+  const StateArrays* states;
+
+  //! (ws, el, node, eq) -> local id in overlappedSolution.
+  const AbstractDiscretization::Conn* wsElNodeEqID;
+
+  //! Element block name of each workset, and all element blocks of the
+  //! mesh (the same on every rank).
+  const WorksetArray<std::string>::type* wsEBNames;
+  std::vector<std::string> blockNames;
+
+  //! Overlapped node coordinates, numDims per node, in the node order of
+  //! overlappedSolution.
+  const Teuchos::ArrayRCP<double>* coordinates;
+
+  Teuchos::RCP<const Teuchos_Comm> comm;
+};
+
+/*! \brief Interface of an in-situ analysis.
+ *
+ *  A plugin is created from its own sublist of "In Situ Analysis" and is
+ *  called on every observation selected by its "Interval". Plugins are
+ *  called on all ranks and may communicate.
+ */
+class InSituPlugin {
+public:
+  virtual ~InSituPlugin () {}
+
+  virtual void analyze (const InSituData& data) = 0;
+};
+
+typedef Teuchos::RCP<InSituPlugin> (*InSituPluginFactory)(
+  const Teuchos::ParameterList& params,
+  const Teuchos::RCP<const Teuchos_Comm>& comm);
+
+/*! \brief Lightweight in-situ analysis driven by the solution observers.
+ *
+ *  Configured in the "In Situ Analysis" sublist of "Problem"; every sublist
+ *  in it defines one analysis:
+ *
+ *      <ParameterList name="In Situ Analysis">
+ *        <ParameterList name="Plastic Strain">
+ *          <Parameter name="Type" type="string" value="Histogram"/>
+ *          <Parameter name="Field" type="string" value="eqps"/>
+ *          <Parameter name="Number of Bins" type="int" value="20"/>
+ *          <Parameter name="Range" type="Array(double)" value="{0.0, 0.2}"/>
+ *          <Parameter name="Interval" type="int" value="10"/>
+ *          <Parameter name="Output File" type="string" value="eqps.csv"/>
+ *        </ParameterList>
+ *      </ParameterList>
+ *
+ *  Built-in types are
+ *    - "Histogram": global histogram of a state ("Field") or of a solution
+ *      component ("Field" = "Solution", "Component");
+ *    - "Block Min Max": min and max of an element state or solution
+ *      component per element block; nodal states are rejected;
+ *    - "Probe Line": a solution component at the nodes closest to
+ *      "Number of Points" points between "Start" and "End".
+ *  Their results are appended on rank 0 to "Output File", one row per
+ *  observation, as CSV or, with "Output Format" = "Binary", as raw doubles
+ *  (stamp first).
+ *
+ *  Applications and other libraries add types with registerPlugin before
+ *  the observers are built.
+ */
+class InSituAnalysis {
+public:
+  InSituAnalysis (
+    const Teuchos::ParameterList& params,
+    const Teuchos::RCP<const Teuchos_Comm>& comm);
+
+  static void registerPlugin (
+    const std::string& type, InSituPluginFactory factory);
+
+  bool isActive () const { return !plugins_.empty(); }
+
+  void observe (
+    const double stamp, const Tpetra_Vector& solution,
+    const Tpetra_Vector& overlappedSolution, AbstractDiscretization& disc);
+
+private:
+  Teuchos::RCP<const Teuchos_Comm> comm_;
+  std::vector<Teuchos::RCP<InSituPlugin> > plugins_;
+  std::vector<int> intervals_;
+  int step_;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_INSITUANALYSIS_HPP
@@ -186,4 +186,125 @@ void printMemoryAnalysis (
   ma.print(os);
 }
 
+namespace {
+// Bytes in use by this process, as well as the available routines tell.
+double processHeapBytes () {
+#if defined(ALBANY_HAVE_MALLINFO)
+  struct mallinfo mi = mallinfo();
+  // Unsigned: the int fields wrap above 2 GB.
+  return static_cast<double>(static_cast<unsigned int>(mi.uordblks)) +
+    static_cast<double>(static_cast<unsigned int>(mi.hblkhd));
+#elif defined(ALBANY_HAVE_GETRUSAGE)
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return 1024.0 * static_cast<double>(ru.ru_maxrss);
+#else
+  return 0;
+#endif
+}
+
+const char* const process_heap = "Process Heap";
+} // namespace
+
+MemoryTracker& MemoryTracker::instance () {
+  static MemoryTracker mt;
+  return mt;
+}
+
+MemoryTracker::MemoryTracker ()
+  : enabled_(false), phase_("Setup")
+{}
+
+void MemoryTracker::
+setComponentBytes (const std::string& component, const double bytes) {
+  if (!enabled_) return;
+  current_[component] = bytes;
+  double& mark = marks_[phase_][component];
+  mark = std::max(mark, bytes);
+}
+
+std::string MemoryTracker::setPhase (const std::string& phase) {
+  if (!enabled_) return phase_;
+  sample();
+  const std::string previous = phase_;
+  phase_ = phase;
+  // Components carry their current size into the new phase.
+  std::map<std::string, double>& marks = marks_[phase_];
+  for (const auto& c : current_)
+    marks[c.first] = std::max(marks[c.first], c.second);
+  sample();
+  return previous;
+}
+
+void MemoryTracker::sample () {
+  if (!enabled_) return;
+  double& mark = marks_[phase_][process_heap];
+  mark = std::max(mark, processHeapBytes());
+}
+
+void MemoryTracker::
+print (std::ostream& os,
+       const Teuchos::RCP< const Teuchos::Comm<int> >& comm) const {
+  if (!enabled_) return;
+
+  // Ranks may have seen different components; use the list of rank 0.
+  std::vector<std::pair<std::string, std::string> > keys;
+  std::string packed;
+  if (comm->getRank() == 0)
+    for (const auto& p : marks_)
+      for (const auto& c : p.second)
+        packed += p.first + '\n' + c.first + '\n';
+  int len = packed.size();
+  Teuchos::broadcast<int, int>(*comm, 0, &len);
+  packed.resize(len);
+  if (len > 0) Teuchos::broadcast<int, char>(*comm, 0, len, &packed[0]);
+  for (std::size_t pos = 0; pos < packed.size(); ) {
+    const std::size_t a = packed.find('\n', pos), b = packed.find('\n', a+1);
+    keys.push_back(std::make_pair(packed.substr(pos, a - pos),
+                                  packed.substr(a+1, b - a - 1)));
+    pos = b + 1;
+  }
+
+  const int n = keys.size(), nproc = comm->getSize();
+  std::vector<double> mine(n, 0.0);
+  for (int i = 0; i < n; ++i) {
+    const auto p = marks_.find(keys[i].first);
+    if (p == marks_.end()) continue;
+    const auto c = p->second.find(keys[i].second);
+    if (c != p->second.end()) mine[i] = c->second;
+  }
+  std::vector<double> all;
+  if (comm->getRank() == 0) all.resize(n*nproc);
+  if (n > 0)
+    Teuchos::gather<int, double>(&mine[0], n, all.data(), n, 0, *comm);
+  if (comm->getRank() != 0) return;
+
+  std::stringstream msg;
+  msg << ">>> Albany Memory High-Water Marks (MB)" << std::endl;
+  msg << "    #ranks: " << nproc << std::endl;
+  msg << std::setw(12) << "phase" << " " << std::setw(28) << "component"
+      << std::setw(12) << "min" << std::setw(12) << "median"
+      << std::setw(12) << "max" << std::setw(6) << "proc" << std::endl;
+  msg << std::fixed << std::setprecision(1);
+  for (int i = 0; i < n; ++i) {
+    std::vector<double> v(nproc);
+    int imax = 0;
+    for (int r = 0; r < nproc; ++r) {
+      v[r] = all[n*r + i];
+      if (v[r] > v[imax]) imax = r;
+    }
+    const double vmax = v[imax];
+    std::nth_element(v.begin(), v.begin() + nproc/2, v.end());
+    const double vmed = v[nproc/2];
+    const double vmin = *std::min_element(v.begin(), v.end());
+    const double mb = 1024.0*1024.0;
+    msg << std::setw(12) << keys[i].first << " " << std::setw(28)
+        << keys[i].second << std::setw(12) << vmin/mb << std::setw(12)
+        << vmed/mb << std::setw(12) << vmax/mb << std::setw(6) << imax
+        << std::endl;
+  }
+  msg << "<<< Albany Memory High-Water Marks" << std::endl;
+  os << msg.str();
+}
+
 } // namespace Albany
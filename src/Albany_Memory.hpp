@@ -8,6 +8,8 @@
 #define ALBANY_MEMORY_HPP
 
 #include <iostream>
+#include <map>
+#include <string>
 #include <Teuchos_Comm.hpp>
 
 namespace Albany {
@@ -49,6 +51,75 @@ namespace Albany {
  */
 void printMemoryAnalysis(
   std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm);
+
+/*! \brief Attribute memory to Albany subsystems and record high-water marks
+ *         per phase of the run.
+ *
+ *  Subsystems report their current footprint with setComponentBytes:
+ *  "State Arrays" from the StateManager, "Jacobian (owned)", "Jacobian
+ *  (overlapped)" and "Linear Jacobian Cache" from the Application, and
+ *  "STK Fields" and "Workset Connectivity" from the STKDiscretization.
+ *  Evaluator fields, solver and preconditioner data and output buffers are
+ *  owned by Phalanx, Stratimikos and Ioss, which do not report their sizes;
+ *  they show up only in the process heap of the "First Fill", "Solve" and
+ *  "Output" phases. Phases ("Setup", "First Fill", "Solve", "Output",
+ *  "Adapt") are entered with a MemoryPhase guard. For every phase the tracker keeps
+ *  the largest value seen for each component and for the process heap
+ *  (mallinfo if enabled, else getrusage's max RSS).
+ *
+ *  The tracker is off unless "Analyze Memory" is set in "Debug Output"; all
+ *  calls are then no-ops, so callers should test isEnabled() before doing
+ *  any work to compute a size. print reports, on rank 0, the min, median
+ *  and max over ranks of each high-water mark.
+ */
+class MemoryTracker {
+public:
+  static MemoryTracker& instance();
+
+  void enable (const bool enabled) { enabled_ = enabled; }
+  bool isEnabled () const { return enabled_; }
+
+  //! Set the current size of a component, in bytes.
+  void setComponentBytes(const std::string& component, const double bytes);
+
+  //! Enter phase; returns the phase that was current.
+  std::string setPhase(const std::string& phase);
+  const std::string& getPhase () const { return phase_; }
+
+  //! Sample process memory and update the marks of the current phase.
+  void sample();
+
+  void print(std::ostream& os,
+             const Teuchos::RCP< const Teuchos::Comm<int> >& comm) const;
+
+private:
+  MemoryTracker ();
+
+  bool enabled_;
+  std::string phase_;
+  std::map<std::string, double> current_;
+  // phase -> component (or "Process Heap") -> high-water mark
+  std::map<std::string, std::map<std::string, double> > marks_;
+};
+
+//! Enters a phase of the MemoryTracker for its lifetime.
+class MemoryPhase {
+public:
+  explicit MemoryPhase (const std::string& phase) {
+    MemoryTracker& mt = MemoryTracker::instance();
+    if (mt.isEnabled()) { previous_ = mt.setPhase(phase); active_ = true; }
+    else active_ = false;
+  }
+  ~MemoryPhase () {
+    if (!active_) return;
+    MemoryTracker& mt = MemoryTracker::instance();
+    mt.sample();
+    mt.setPhase(previous_);
+  }
+private:
+  bool active_;
+  std::string previous_;
+};
 }
 
 #endif // ALBANY_MEMORY_HPP
@@ -201,7 +201,8 @@ void subtractCentroid(const Teuchos::RCP<Tpetra_MultiVector> &coordMV)
 
 RigidBodyModes::RigidBodyModes(int numPDEs_)
   : numPDEs(numPDEs_), numElasticityDim(0), nullSpaceDim(0),
-    numScalar(0), mlUsed(false), mueLuUsed(false), setNonElastRBM(false)
+    numScalar(0), mlUsed(false), mueLuUsed(false), ifpack2Used(false),
+    setNonElastRBM(false), columnLinesRequested(false)
 {}
 
 void RigidBodyModes::
@@ -210,7 +211,7 @@ setPiroPL(const Teuchos::RCP<Teuchos::ParameterList>& piroParams)
   const Teuchos::RCP<Teuchos::ParameterList>
     stratList = Piro::extractStratimikosParams(piroParams);
 
-  mlUsed = mueLuUsed = false;
+  mlUsed = mueLuUsed = ifpack2Used = false;
   if (Teuchos::nonnull(stratList) &&
       stratList->isParameter("Preconditioner Type")) {
     const std::string&
@@ -224,13 +225,20 @@ setPiroPL(const Teuchos::RCP<Teuchos::ParameterList>& piroParams)
       plist = sublist(sublist(stratList, "Preconditioner Types"), ptype);
       mueLuUsed = true;
     }
+    else if (ptype == "Ifpack2") {
+      plist = sublist(sublist(sublist(stratList, "Preconditioner Types"),
+                              ptype), "Ifpack2 Settings");
+      ifpack2Used = true;
+    }
   }
+  detectColumnLines();
 }
 
 void RigidBodyModes::
 updatePL(const Teuchos::RCP<Teuchos::ParameterList>& mlParams)
 {
   plist = mlParams;
+  detectColumnLines();
 }
 
 void RigidBodyModes::setParameters(
@@ -297,6 +305,52 @@ setCoordinates(const Teuchos::RCP<Tpetra_MultiVector> &coordMV_)
   }
 }
 
+void RigidBodyModes::detectColumnLines()
+{
+  // Decide this once, from the list as the user wrote it. setColumnLines
+  // fills "partitioner: map" itself, and must do so again on every mesh
+  // update.
+  columnLinesRequested = false;
+  if (isIfpack2Used())
+    columnLinesRequested =
+      plist->isType<std::string>("partitioner: type") &&
+      plist->get<std::string>("partitioner: type") == "user" &&
+      !plist->isParameter("partitioner: map");
+  else if (isMueLuUsed())
+    columnLinesRequested =
+      plist->isType<std::string>("linedetection: orientation") &&
+      plist->get<std::string>("linedetection: orientation") == "vertical";
+}
+
+void RigidBodyModes::
+setColumnLines(const Teuchos::ArrayRCP<LO_type>& dofColumnIds,
+               const LO_type numColumns,
+               const Teuchos::ArrayRCP<LO_type>& nodeColumnIds,
+               const Teuchos::ArrayRCP<LO_type>& nodeLevelIds,
+               const int numLevels)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    !isColumnLinesRequested(),
+    std::logic_error,
+    "setColumnLines was called without an Ifpack2 user partitioner or a MueLu vertical line detection parameter list.");
+
+  if (isIfpack2Used()) {
+    // One block per column; the banded container then does an exact LU of
+    // the (block-)tridiagonal column matrix.
+    plist->set("partitioner: map", dofColumnIds);
+    plist->set("partitioner: local parts", numColumns);
+    plist->get("relaxation: container", "Banded");
+  } else {
+    // Hand MueLu the exact columns; they are used by the line smoothers and
+    // by semicoarsening, if enabled.
+    plist->get("linedetection: num layers", numLevels);
+    Teuchos::ParameterList& level0 = plist->sublist("level 0");
+    level0.set("LineDetection_VertLineIds", nodeColumnIds);
+    level0.set("LineDetection_Layers", nodeLevelIds);
+    level0.set("CoarseNumZLayers", numLevels);
+  }
+}
+
 void RigidBodyModes::
 setCoordinatesAndNullspace(const Teuchos::RCP<Tpetra_MultiVector> &coordMV,
                            const Teuchos::RCP<const Tpetra_Map>& soln_map)
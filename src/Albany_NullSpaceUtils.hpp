@@ -89,6 +89,17 @@ public:
   //! Is MueLu used on this problem?
   bool isMueLuUsed() const { return mueLuUsed; }
 
+  //! Is Ifpack2 used on this problem?
+  bool isIfpack2Used() const { return ifpack2Used; }
+
+  //! Does the preconditioner want the vertical columns of a layered mesh?
+  //! This is the case for Ifpack2 block relaxation with a "user" partitioner
+  //! and no "partitioner: map" in the input, and for MueLu with
+  //! "linedetection: orientation" = "vertical". It stays true after
+  //! setColumnLines, so the columns are passed again after every mesh
+  //! update.
+  bool isColumnLinesRequested() const { return columnLinesRequested; }
+
   //! Pass coordinates and, if numElasticityDim > 0, the null space to ML or
   //! MueLu. The data accessed through getCoordArrays must have been
   //! set. soln_map must be set only if using MueLu and numElasticityDim >
@@ -100,9 +111,22 @@ public:
   //! Pass only the coordinates.
   void setCoordinates(const Teuchos::RCP<Tpetra_MultiVector> &coordMV);
 
+  //! Pass the vertical columns of a layered mesh, so that the line solves
+  //! and semicoarsening need no algebraic line detection. dofColumnIds maps
+  //! each owned dof (row of the Jacobian) to a local column in
+  //! [0,numColumns); nodeColumnIds and nodeLevelIds do the same for each
+  //! owned node and its level in [0,numLevels).
+  void setColumnLines(const Teuchos::ArrayRCP<LO_type>& dofColumnIds,
+                      const LO_type numColumns,
+                      const Teuchos::ArrayRCP<LO_type>& nodeColumnIds,
+                      const Teuchos::ArrayRCP<LO_type>& nodeLevelIds,
+                      const int numLevels);
+
 private:
+  void detectColumnLines();
+
   int numPDEs, numElasticityDim, numScalar, nullSpaceDim;
-  bool mlUsed, mueLuUsed, setNonElastRBM;
+  bool mlUsed, mueLuUsed, ifpack2Used, setNonElastRBM, columnLinesRequested;
 
   Teuchos::RCP<Teuchos::ParameterList> plist;
 
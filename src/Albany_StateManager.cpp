@@ -8,6 +8,7 @@
 //No Epetra if ALBANY_EPETRA_EXE turned off.
 
 #include "Albany_StateManager.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_VerboseObject.hpp"
 #include "Teuchos_TestForException.hpp"
@@ -549,6 +550,17 @@ Albany::StateManager::setStateArrays(const Teuchos::RCP<Albany::AbstractDiscreti
 
   doSetStateArrays(disc,stateInfo);
 
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled()) {
+    const Albany::StateArrays& sa = disc->getStateArrays();
+    double bytes = 0;
+    for (const auto& ws : sa.elemStateArrays)
+      for (const auto& st : ws) bytes += st.second.size()*sizeof(double);
+    for (const auto& ws : sa.nodeStateArrays)
+      for (const auto& st : ws) bytes += st.second.size()*sizeof(double);
+    mt.setComponentBytes("State Arrays", bytes);
+  }
+
   // First, we check the explicitly required side discretizations exist...
   const auto& ss_discs = disc->getSideSetDiscretizations();
   for (auto const& it : sideSetStateInfo)
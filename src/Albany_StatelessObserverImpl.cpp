@@ -6,6 +6,7 @@
 #include "Albany_StatelessObserverImpl.hpp"
 
 #include "Albany_AbstractDiscretization.hpp"
+#include "Albany_Memory.hpp"
 #if defined(ALBANY_EPETRA)
 #include "AAdapt_AdaptiveSolutionManager.hpp"
 #endif
@@ -20,7 +21,16 @@ StatelessObserverImpl::
 StatelessObserverImpl (const Teuchos::RCP<Application> &app)
   : app_(app),
   solOutTime_(Teuchos::TimeMonitor::getNewTimer("Albany: Output to File"))
-{}
+{
+  const Teuchos::RCP<const Teuchos::ParameterList> problemParams =
+    app_->getProblemPL();
+  if (Teuchos::nonnull(problemParams) &&
+      problemParams->isSublist("In Situ Analysis")) {
+    inSitu_ = Teuchos::rcp(new InSituAnalysis(
+      problemParams->sublist("In Situ Analysis"), app_->getComm()));
+    if (!inSitu_->isActive()) inSitu_ = Teuchos::null;
+  }
+}
 
 RealType StatelessObserverImpl::
 getTimeParamValueOrDefault (RealType defaultValue) const {
@@ -48,6 +58,7 @@ void StatelessObserverImpl::observeSolution (
   const Teuchos::Ptr<const Epetra_Vector>& nonOverlappedSolutionDot)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  MemoryPhase memory_phase("Output");
   const Teuchos::Ptr<const Epetra_Vector> overlappedSolution(
     app_->getAdaptSolMgr()->getOverlapSolution(nonOverlappedSolution));
   
@@ -69,6 +80,7 @@ void StatelessObserverImpl::observeSolutionT (
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotT)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  MemoryPhase memory_phase("Output");
   const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
     app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionT(nonOverlappedSolutionT);
   if (nonOverlappedSolutionDotT != Teuchos::null) {
@@ -81,6 +93,9 @@ void StatelessObserverImpl::observeSolutionT (
     app_->getDiscretization()->writeSolutionT(
       *overlappedSolutionT, stamp, /*overlapped =*/ true);
   }
+  if (Teuchos::nonnull(inSitu_))
+    inSitu_->observe(stamp, nonOverlappedSolutionT, *overlappedSolutionT,
+                     *app_->getDiscretization());
 }
 
 void StatelessObserverImpl::observeSolutionT (
@@ -89,6 +104,7 @@ void StatelessObserverImpl::observeSolutionT (
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotDotT)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  MemoryPhase memory_phase("Output");
   const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
     app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionT(nonOverlappedSolutionT);
   if (nonOverlappedSolutionDotT != Teuchos::null) {
@@ -110,6 +126,9 @@ void StatelessObserverImpl::observeSolutionT (
     app_->getDiscretization()->writeSolutionT(
       *overlappedSolutionT, stamp, /*overlapped =*/ true);
   }
+  if (Teuchos::nonnull(inSitu_))
+    inSitu_->observe(stamp, nonOverlappedSolutionT, *overlappedSolutionT,
+                     *app_->getDiscretization());
 }
 
 
@@ -117,10 +136,15 @@ void StatelessObserverImpl::observeSolutionT (
   double stamp, const Tpetra_MultiVector &nonOverlappedSolutionT)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  MemoryPhase memory_phase("Output");
   const Teuchos::RCP<const Tpetra_MultiVector> overlappedSolutionT =
     app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionMV(nonOverlappedSolutionT);
   app_->getDiscretization()->writeSolutionMV(
     *overlappedSolutionT, stamp, /*overlapped =*/ true);
+  if (Teuchos::nonnull(inSitu_))
+    inSitu_->observe(stamp, *nonOverlappedSolutionT.getVector(0),
+                     *overlappedSolutionT->getVector(0),
+                     *app_->getDiscretization());
 }
 
 } // namespace Albany
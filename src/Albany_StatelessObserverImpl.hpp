@@ -8,6 +8,7 @@
 
 #include "Albany_Application.hpp"
 #include "Albany_DataTypes.hpp"
+#include "Albany_InSituAnalysis.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Map.h"
@@ -85,6 +86,8 @@ public:
 protected:
   Teuchos::RCP<Application> app_;
   Teuchos::RCP<Teuchos::Time> solOutTime_;
+  //! Non-null if the problem has an "In Situ Analysis" sublist.
+  Teuchos::RCP<InSituAnalysis> inSitu_;
 
 private:
   StatelessObserverImpl(const StatelessObserverImpl&);
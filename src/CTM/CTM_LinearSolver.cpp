@@ -47,24 +47,6 @@ static RCP<ParameterList> get_belos_params(RCP<const ParameterList> in) {
   return p;
 }
 
-static RCP<Solver> build_muelu_solver(
-    RCP<const ParameterList> in,
-    RCP<Tpetra_CrsMatrix> A,
-    RCP<Tpetra_Vector> x,
-    RCP<Tpetra_Vector> b,
-    RCP<Tpetra_MultiVector> coords,
-    RCP<Tpetra_MultiVector> nullspace) {
-  auto muelu_params = in->sublist("Preconditioner");
-  auto belos_params = get_belos_params(in);
-  auto AA = (RCP<OP>)A;
-  auto M = MueLu::CreateTpetraPreconditioner(AA, muelu_params, coords, nullspace);
-  auto problem = rcp(new LinearProblem(A, x, b));
-  problem->setLeftPrec(M);
-  problem->setProblem();
-  auto solver = rcp(new GmresSolver(problem, belos_params));
-  return solver;
-}
-
 static void get_inv_row_sum(RCP<Tpetra_CrsMatrix> A, RCP<Tpetra_Vector> s) {
   s->putScalar(0.0);
   auto view = s->get1dViewNonConst();
@@ -249,6 +231,55 @@ void solve_linear_system(
     RCP<Tpetra_Vector> x,
     RCP<Tpetra_Vector> b,
     RCP<Albany::AbstractDiscretization> d) {
+  LinearSolver solver(in, d);
+  solver.solve(A, x, b);
+}
+
+typedef MueLu::TpetraOperator<ST, LO, GO, KokkosNode> MueLuPrec;
+
+struct LinearSolver::Impl {
+  RCP<const ParameterList> params;
+  RCP<Albany::AbstractDiscretization> disc;
+  std::string reuse;
+  int reuse_steps;
+  int num_uses;
+  RCP<MueLuPrec> prec;
+  RCP<LinearProblem> problem;
+  RCP<Solver> solver;
+};
+
+LinearSolver::LinearSolver(
+    RCP<const ParameterList> p,
+    RCP<Albany::AbstractDiscretization> d) {
+  impl = rcp(new Impl);
+  impl->params = p;
+  impl->disc = d;
+  impl->reuse = "Rebuild";
+  if (p->isType<std::string>("Preconditioner Reuse"))
+    impl->reuse = p->get<std::string>("Preconditioner Reuse");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      impl->reuse != "Rebuild" && impl->reuse != "Reuse Symbolic" &&
+      impl->reuse != "Reuse Numeric", std::logic_error,
+      "CTM: unknown Preconditioner Reuse " << impl->reuse << "\n");
+  impl->reuse_steps = 1;
+  if (p->isType<int>("Preconditioner Reuse Steps"))
+    impl->reuse_steps = p->get<int>("Preconditioner Reuse Steps");
+  impl->num_uses = 0;
+}
+
+void LinearSolver::invalidate() {
+  impl->prec = Teuchos::null;
+  impl->problem = Teuchos::null;
+  impl->solver = Teuchos::null;
+  impl->num_uses = 0;
+}
+
+void LinearSolver::solve(
+    RCP<Tpetra_CrsMatrix> A,
+    RCP<Tpetra_Vector> x,
+    RCP<Tpetra_Vector> b) {
+
+  auto in = impl->params;
 
   // useful timing info
   RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
@@ -259,19 +290,54 @@ void solve_linear_system(
   // not sure this actually helps at all ?
   scale_system(in, A, b, out);
 
-  // get the coordinates and the null space if specified
-  RCP<Tpetra_MultiVector> coords;
-  RCP<Tpetra_MultiVector> nullspace;
-  if (d != Teuchos::null) {
-    coords = get_coords(d, out);
-  }
+  // build, refresh or reuse the preconditioner
+  if (impl->reuse == "Rebuild" || impl->prec == Teuchos::null) {
+
+    // get the coordinates and the null space if specified
+    RCP<Tpetra_MultiVector> coords;
+    RCP<Tpetra_MultiVector> nullspace;
+    if (impl->disc != Teuchos::null) {
+      coords = get_coords(impl->disc, out);
+    }
+
+    // keep the tentative prolongator so the hierarchy can be recomputed
+    auto muelu_params = in->sublist("Preconditioner");
+    if (impl->reuse != "Rebuild" && ! muelu_params.isParameter("reuse: type"))
+      muelu_params.set("reuse: type", "tP");
+    auto AA = (RCP<OP>)A;
+    impl->prec = MueLu::CreateTpetraPreconditioner(
+        AA, muelu_params, coords, nullspace);
+    impl->num_uses = 0;
+    *out << "  linear solver: built preconditioner" << std::endl;
 
-  // build the solver and solve
-  RCP<Solver> solver = build_muelu_solver(in, A, x, b, coords, nullspace);
-  solver->solve();
+  } else if (impl->reuse == "Reuse Symbolic" ||
+             impl->num_uses >= impl->reuse_steps) {
+
+    MueLu::ReuseTpetraPreconditioner(A, *(impl->prec));
+    impl->num_uses = 0;
+    *out << "  linear solver: recomputed preconditioner" << std::endl;
+
+  } else {
+    *out << "  linear solver: reusing preconditioner" << std::endl;
+  }
+  ++impl->num_uses;
+
+  // keep the Krylov solver and its workspace across solves
+  if (impl->solver == Teuchos::null) {
+    impl->problem = rcp(new LinearProblem(A, x, b));
+    impl->problem->setLeftPrec(impl->prec);
+    impl->problem->setProblem();
+    impl->solver = rcp(new GmresSolver(impl->problem, get_belos_params(in)));
+  } else {
+    impl->problem->setOperator(A);
+    impl->problem->setLeftPrec(impl->prec);
+    impl->problem->setProblem(x, b);
+    impl->solver->reset(Belos::Problem);
+  }
+  impl->solver->solve();
 
   // print some final information
-  int iters = solver->getNumIters();
+  int iters = impl->solver->getNumIters();
   double t1 = PCU_Time();
   if (iters >= in->get<int>("Linear Max Iterations")) {
     *out << "  linear solve failed to converge in " << iters << " iterations" << std::endl;
@@ -19,6 +19,38 @@ void solve_linear_system(
     RCP<Tpetra_Vector> b,
     RCP<Albany::AbstractDiscretization> d = Teuchos::null);
 
+/* A linear solver that keeps its MueLu preconditioner and Belos solver
+ * across solves. The "Preconditioner Reuse" parameter selects the policy:
+ *   "Rebuild"        - build a new preconditioner for every solve (default)
+ *   "Reuse Symbolic" - keep the MueLu aggregates and prolongators, and only
+ *                      recompute the numeric hierarchy for the new matrix
+ *   "Reuse Numeric"  - apply the same preconditioner for
+ *                      "Preconditioner Reuse Steps" solves, then refresh
+ *                      it as with "Reuse Symbolic"
+ * Call invalidate() whenever the matrix structure changes, e.g. after
+ * mesh adaptation; the next solve then rebuilds everything. */
+class LinearSolver {
+
+  public:
+
+    LinearSolver(
+        RCP<const ParameterList> p,
+        RCP<Albany::AbstractDiscretization> d = Teuchos::null);
+
+    void solve(
+        RCP<Tpetra_CrsMatrix> A,
+        RCP<Tpetra_Vector> x,
+        RCP<Tpetra_Vector> b);
+
+    void invalidate();
+
+  private:
+
+    struct Impl;
+    RCP<Impl> impl;
+
+};
+
 } // namespace CTM
 
 #endif
@@ -134,6 +134,12 @@ void Solver::initial_setup() {
   m_assembler = rcp(new Assembler(
         m_params, m_sol_info, m_problem, m_disc, m_state_mgr));
 
+  // build the linear solvers, kept across steps to reuse preconditioners
+  auto tla_params = rcpFromRef(params->sublist("Temp Linear Algebra"));
+  auto mla_params = rcpFromRef(params->sublist("Mech Linear Algebra"));
+  t_linear_solver = rcp(new LinearSolver(tla_params));
+  m_linear_solver = rcp(new LinearSolver(mla_params, m_disc));
+
   // set the state arrays
   *out << std::endl;
   t_state_mgr->setStateArrays(t_disc);
@@ -153,9 +159,6 @@ void Solver::solve_temp() {
 
   *out << "Solving thermal physics" << std::endl;
 
-  // get linear solve parameters
-  auto la_params = rcpFromRef(params->sublist("Temp Linear Algebra"));
-
   // get the thermal solution info
   auto T = t_sol_info->owned->x;
   auto dTdt = t_sol_info->owned->x_dot;
@@ -178,7 +181,7 @@ void Solver::solve_temp() {
   t_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
   delta_T->putScalar(0.0);
-  solve_linear_system(la_params, J, delta_T, f);
+  t_linear_solver->solve(J, delta_T, f);
 
   // perform updates
   T->update(1.0, *delta_T, 1.0);
@@ -196,9 +199,6 @@ void Solver::solve_mech() {
 
   *out << "Solving mechanics physics" << std::endl;
 
-  // get linear solve parameters
-  auto la_params = rcpFromRef(params->sublist("Mech Linear Algebra"));
-
   // get the mechanics solution
   auto u = m_sol_info->owned->x;
   auto f = m_sol_info->owned->f;
@@ -213,7 +213,7 @@ void Solver::solve_mech() {
   u->putScalar(0.0);
   m_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
-  solve_linear_system(la_params, J, u, f, m_disc);
+  m_linear_solver->solve(J, u, f);
 
   // perform updates
   m_assembler->assemble_state(t_current, t_old);
@@ -234,6 +234,8 @@ void Solver::adapt_mesh() {
   m_sol_info->owned->x = m_disc->getSolutionFieldT();
   t_sol_info->scatter_x();
   m_sol_info->scatter_x();
+  t_linear_solver->invalidate();
+  m_linear_solver->invalidate();
 }
 
 void Solver::solve() {
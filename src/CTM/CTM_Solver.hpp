@@ -22,6 +22,7 @@ using Teuchos::ParameterList;
 class SolutionInfo;
 class Assembler;
 class Adapter;
+class LinearSolver;
 
 class Solver {
 
@@ -60,6 +61,9 @@ class Solver {
     RCP<Assembler> t_assembler;
     RCP<Assembler> m_assembler;
 
+    RCP<LinearSolver> t_linear_solver;
+    RCP<LinearSolver> m_linear_solver;
+
     RCP<Adapter> adapter;
 
     int num_steps;
@@ -0,0 +1,120 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Tpetra_DefaultPlatform.hpp>
+#include "CTM_LinearSolver.hpp"
+
+namespace
+{
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+// Sizes of the system before and after the "adapt".
+const int n_before = 300, n_after = 420;
+const int num_steps = 4;
+
+// A 1D Laplacian plus a diagonal shift that changes from step to step, so
+// that reused preconditioners are applied to a matrix that has changed.
+RCP<Tpetra_CrsMatrix>
+buildMatrix (const RCP<const Tpetra_Map>& map, const int step)
+{
+  RCP<Tpetra_CrsMatrix> A = rcp(new Tpetra_CrsMatrix(map, 3));
+  const GO n = map->getGlobalNumElements();
+  const ST diag = 2.0 + 0.05*step;
+  for (LO i = 0; i < (LO) map->getNodeNumElements(); ++i) {
+    const GO row = map->getGlobalElement(i);
+    Teuchos::Array<GO> cols;
+    Teuchos::Array<ST> vals;
+    if (row > 0) { cols.push_back(row-1); vals.push_back(-1.0); }
+    cols.push_back(row); vals.push_back(diag);
+    if (row < n-1) { cols.push_back(row+1); vals.push_back(-1.0); }
+    A->insertGlobalValues(row, cols, vals);
+  }
+  A->fillComplete();
+  return A;
+}
+
+RCP<Tpetra_Vector>
+buildRhs (const RCP<const Tpetra_Map>& map, const int step)
+{
+  RCP<Tpetra_Vector> b = rcp(new Tpetra_Vector(map));
+  for (LO i = 0; i < (LO) map->getNodeNumElements(); ++i) {
+    const GO row = map->getGlobalElement(i);
+    b->replaceLocalValue(i, 1.0 + 0.01*((row + step) % 7));
+  }
+  return b;
+}
+
+RCP<Teuchos::ParameterList>
+solverParams (const std::string& reuse)
+{
+  RCP<Teuchos::ParameterList> p = rcp(new Teuchos::ParameterList);
+  p->set("Linear Tolerance", 1.0e-10);
+  p->set("Linear Max Iterations", 200);
+  p->set("Linear Krylov Size", 200);
+  p->set("Preconditioner Reuse", reuse);
+  p->set("Preconditioner Reuse Steps", 2);
+  Teuchos::ParameterList& muelu = p->sublist("Preconditioner");
+  muelu.set("verbosity", "none");
+  muelu.set("coarse: max size", 20);
+  return p;
+}
+
+// Solves num_steps systems, "adapts" to a larger system, invalidates the
+// solver as CTM::Solver::adapt_mesh does, and solves num_steps more. Each
+// solution is compared with the one of a solver built afresh.
+void
+checkPolicy (Teuchos::FancyOStream& out, bool& success,
+             const std::string& reuse)
+{
+  const RCP<const Teuchos_Comm> comm =
+    Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+  CTM::LinearSolver solver(solverParams(reuse));
+
+  for (int phase = 0; phase < 2; ++phase) {
+    if (phase == 1) solver.invalidate();
+    const RCP<const Tpetra_Map> map =
+      rcp(new Tpetra_Map(phase == 0 ? n_before : n_after, 0, comm));
+    for (int step = 0; step < num_steps; ++step) {
+      const RCP<Tpetra_CrsMatrix> A = buildMatrix(map, step);
+      const RCP<Tpetra_Vector> b = buildRhs(map, step);
+      const RCP<Tpetra_Vector> x = rcp(new Tpetra_Vector(map));
+      solver.solve(A, x, b);
+
+      const RCP<Tpetra_Vector> x_ref = rcp(new Tpetra_Vector(map));
+      CTM::solve_linear_system(solverParams("Rebuild"), buildMatrix(map, step),
+                               x_ref, buildRhs(map, step));
+
+      // The residual of the reused solver's solution...
+      Tpetra_Vector r(map);
+      A->apply(*x, r);
+      r.update(1.0, *buildRhs(map, step), -1.0);
+      TEST_COMPARE(r.norm2(), <=, 1.0e-8*b->norm2());
+      // ...and its distance to the freshly built solver's.
+      x_ref->update(-1.0, *x, 1.0);
+      TEST_COMPARE(x_ref->norm2(), <=, 1.0e-6*x->norm2());
+    }
+  }
+}
+
+} // namespace
+
+TEUCHOS_UNIT_TEST(CTMLinearSolver, Rebuild)
+{
+  checkPolicy(out, success, "Rebuild");
+}
+
+TEUCHOS_UNIT_TEST(CTMLinearSolver, ReuseSymbolic)
+{
+  checkPolicy(out, success, "Reuse Symbolic");
+}
+
+TEUCHOS_UNIT_TEST(CTMLinearSolver, ReuseNumeric)
+{
+  checkPolicy(out, success, "Reuse Numeric");
+}
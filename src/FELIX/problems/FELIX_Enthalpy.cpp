@@ -157,6 +157,7 @@ constructDirichletEvaluators(const Albany::MeshSpecsStruct& meshSpecs)
    Albany::BCUtils<Albany::DirichletTraits> dirUtils;
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames, this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets();
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 void FELIX::Enthalpy::
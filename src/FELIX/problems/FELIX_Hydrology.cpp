@@ -149,6 +149,7 @@ void FELIX::Hydrology::constructDirichletEvaluators (const Albany::MeshSpecsStru
   Sacado::mpl::for_each<PHAL::AlbanyTraits::BEvalTypes> fe(op);
 
   offsets_ = dirUtils.getOffsets();
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 void FELIX::Hydrology::constructNeumannEvaluators (const Teuchos::RCP<Albany::MeshSpecsStruct>& meshSpecs)
@@ -149,6 +149,7 @@ FELIX::Stokes::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets();
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 //Neumann BCs
@@ -228,6 +228,7 @@ FELIX::StokesFOThermoCoupled::constructDirichletEvaluators(
   dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                        this->params, this->paramLib);
   offsets_ = dirUtils.getOffsets();
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -100,6 +100,7 @@ Albany::HydMorphProblem::constructDirichletEvaluators(const std::vector<std::str
    dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
                                           this->params, this->paramLib);
    offsets_ = bcUtils.getOffsets(); 
+   dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -95,6 +95,7 @@ Albany::HydrideProblem::constructDirichletEvaluators(const std::vector<std::stri
    dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
                                           this->params, this->paramLib);
    offsets_ = bcUtils.getOffsets(); 
+   dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
@@ -99,6 +99,7 @@ Albany::LaplaceBeltramiProblem::constructDirichletEvaluators(const std::vector<s
   dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
                                       this->params, this->paramLib, numDim);
   offsets_ = bcUtils.getOffsets(); 
+  dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 
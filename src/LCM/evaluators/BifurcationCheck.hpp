@@ -59,6 +59,19 @@ namespace LCM {
     //! Input: Parametrization sweep interval
     double parametrization_interval_;
 
+    //! Input: initial interval of coarse-to-fine search (off if not larger
+    //! than parametrization_interval_)
+    double coarse_interval_;
+
+    //! Input: skip the search where strong ellipticity is proven cheaply
+    bool screening_;
+
+    //! Input: relative eigenvalue margin required by the screening
+    double screening_tolerance_;
+
+    //! Input: search only in the Residual evaluation
+    bool residual_only_;
+
     //! Input: material tangent
     PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim,Dim,Dim> tangent_;
 
@@ -77,6 +90,30 @@ namespace LCM {
     //! number of spatial dimensions
     int num_dims_;
     
+    ///
+    /// Search for the minimum of det(A) at one point
+    ///
+    void
+    checkPoint(int const cell, int const pt);
+
+    ///
+    /// Cholesky-based sufficient condition for strong ellipticity.
+    /// On success, lower_bound bounds the eigenvalues of A(n) from below.
+    ///
+    bool
+    is_strongly_elliptic(minitensor::Tensor4<ScalarT, 3> const & tangent,
+      ScalarT & lower_bound);
+
+    ///
+    /// Coarse-to-fine refinement of a sweep around arg_minimum
+    ///
+    template<typename Parametrization, minitensor::Index P>
+    ScalarT
+    refine_sweep(minitensor::Tensor4<ScalarT, 3> const & tangent,
+      minitensor::Vector<ScalarT, P> & arg_minimum,
+      minitensor::Vector<ScalarT, 3> & direction,
+      ScalarT spacing, ScalarT const & fine_spacing);
+
     ///
     /// Spherical parametrization sweep
     ///
@@ -4,7 +4,10 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <cmath>
 #include <random>
+#include <type_traits>
 #include <typeinfo>
 
 #include "Teuchos_TestForException.hpp"
@@ -22,6 +25,14 @@ namespace LCM {
                    const Teuchos::RCP<Albany::Layouts>& dl) :
     parametrization_type_(p.get<std::string>("Parametrization Type Name")),
     parametrization_interval_(p.get<double>("Parametrization Interval Name")),
+    coarse_interval_(p.isParameter("Coarse Parametrization Interval") ?
+        p.get<double>("Coarse Parametrization Interval") : 0.0),
+    screening_(p.isParameter("Ellipticity Screening") ?
+        p.get<bool>("Ellipticity Screening") : false),
+    screening_tolerance_(p.isParameter("Screening Tolerance") ?
+        p.get<double>("Screening Tolerance") : 1.0e-2),
+    residual_only_(p.isParameter("Residual Only") ?
+        p.get<bool>("Residual Only") : true),
     tangent_(p.get<std::string>("Material Tangent Name"),dl->qp_tensor4),
     ellipticity_flag_(p.get<std::string>("Ellipticity Flag Name"),dl->qp_scalar),
     direction_(p.get<std::string>("Bifurcation Direction Name"),dl->qp_vector),
@@ -57,137 +68,347 @@ namespace LCM {
   template<typename EvalT, typename Traits>
   void BifurcationCheck<EvalT, Traits>::
   evaluateFields(typename Traits::EvalData workset)
+  {
+    // The search is not differentiated, so by default only the residual
+    // evaluation pays for it; other types report a neutral result.
+    bool const
+    is_residual = std::is_same<EvalT, PHAL::AlbanyTraits::Residual>::value;
+
+    if (residual_only_ == true && is_residual == false) {
+      for (int cell(0); cell < workset.numCells; ++cell) {
+        for (int pt(0); pt < num_pts_; ++pt) {
+          ellipticity_flag_(cell,pt) = 1;
+          min_detA_(cell,pt) = 1.0;
+          for (int i(0); i < num_dims_; ++i) {
+            direction_(cell,pt,i) = 0.0;
+          }
+        }
+      }
+      return;
+    }
+
+    // Points are independent.
+    auto
+    check_ptr = this;
+
+    Kokkos::parallel_for(
+      Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>>(
+        0, workset.numCells),
+      [=](int cell) {
+        for (int pt = 0; pt < num_pts_; ++pt) {
+          check_ptr->checkPoint(cell, pt);
+        }
+      });
+
+    Kokkos::fence();
+  }
+
+  //----------------------------------------------------------------------------
+  template<typename EvalT, typename Traits>
+  void BifurcationCheck<EvalT, Traits>::
+  checkPoint(int const cell, int const pt)
   {
     minitensor::Vector<ScalarT, 3> direction(1.0, 0.0, 0.0);
     minitensor::Tensor4<ScalarT, 3> tangent;
-    bool ellipticity_flag(false);
     ScalarT min_detA(1.0);
 
-    for (int cell(0); cell < workset.numCells; ++cell) {
-      for (int pt(0); pt < num_pts_; ++pt) {
+    tangent.fill(tangent_,cell,pt,0,0,0,0);
 
-        tangent.fill( tangent_,cell,pt,0,0,0,0);
-        ellipticity_flag_(cell,pt) = 0;
-       
-        double interval = parametrization_interval_;
+    ScalarT lower_bound(0.0);
 
-        if (parametrization_type_ == "Oliver") {
-            
-          boost::tie(ellipticity_flag, direction) 
-            = minitensor::check_strong_ellipticity(tangent);
-          min_detA = minitensor::det(
-            minitensor::dot2(direction,minitensor::dot(tangent, direction)));
+    if (screening_ == true && is_strongly_elliptic(tangent, lower_bound)) {
+      // Far from localization: no search, report the bound.
+      ellipticity_flag_(cell,pt) = 1;
+      min_detA_(cell,pt) = lower_bound * lower_bound * lower_bound;
+      for (int i(0); i < num_dims_; ++i) {
+        direction_(cell,pt,i) = 0.0;
+      }
+      return;
+    }
+
+    double const
+    interval = parametrization_interval_;
+
+    // Coarse-to-fine search if a coarser starting interval is given.
+    bool const
+    refine = coarse_interval_ > interval;
+
+    double const
+    sweep_interval = refine == true ? coarse_interval_ : interval;
+
+    double const
+    pi = std::acos(-1.0);
+
+    if (parametrization_type_ == "Oliver") {
+
+      bool ellipticity_flag(false);
+
+      boost::tie(ellipticity_flag, direction)
+        = minitensor::check_strong_ellipticity(tangent);
+      min_detA = minitensor::det(
+        minitensor::dot2(direction,minitensor::dot(tangent, direction)));
+    }
+    else if (parametrization_type_ == "PSO") {
+
+      minitensor::Vector<ScalarT, 2> arg_minimum;
+
+      min_detA = stereographic_pso(tangent, arg_minimum, direction);
+
+    }
+    else if (parametrization_type_ == "Stereographic") {
+
+      minitensor::Vector<ScalarT, 2> arg_minimum;
+
+      min_detA = stereographic_sweep(tangent, arg_minimum, direction,
+        sweep_interval);
+      if (refine == true) {
+        min_detA = refine_sweep<minitensor::StereographicParametrization<
+          ScalarT, 3>>(tangent, arg_minimum, direction,
+          sweep_interval, interval);
+      }
+      stereographic_newton_raphson(tangent, arg_minimum, direction, min_detA);
+
+    }
+    else if (parametrization_type_ == "Projective") {
+
+      minitensor::Vector<ScalarT, 3> arg_minimum;
+
+      min_detA = projective_sweep(tangent, arg_minimum, direction,
+        sweep_interval);
+      if (refine == true) {
+        min_detA = refine_sweep<minitensor::ProjectiveParametrization<
+          ScalarT, 3>>(tangent, arg_minimum, direction,
+          sweep_interval, interval);
+      }
+      projective_newton_raphson(tangent, arg_minimum, direction, min_detA);
+
+    }
+    else if (parametrization_type_ == "Tangent") {
+
+      minitensor::Vector<ScalarT, 2> arg_minimum;
+
+      min_detA = tangent_sweep(tangent, arg_minimum, direction,
+        sweep_interval);
+      if (refine == true) {
+        min_detA = refine_sweep<minitensor::TangentParametrization<
+          ScalarT, 3>>(tangent, arg_minimum, direction,
+          pi * sweep_interval / 2.0, pi * interval / 2.0);
+      }
+      tangent_newton_raphson(tangent, arg_minimum, direction, min_detA);
+
+    }
+    else if (parametrization_type_ == "Cartesian") {
+
+      minitensor::Vector<ScalarT, 2> arg_minimum1;
+      minitensor::Vector<ScalarT, 2> arg_minimum2;
+      minitensor::Vector<ScalarT, 2> arg_minimum3;
+      minitensor::Vector<ScalarT, 3> direction1(1.0, 0.0, 0.0);
+      minitensor::Vector<ScalarT, 3> direction2(0.0, 1.0, 0.0);
+      minitensor::Vector<ScalarT, 3> direction3(0.0, 0.0, 1.0);
+
+      ScalarT min_detA1 = cartesian_sweep(tangent,
+        arg_minimum1, 1, direction1, interval);
+
+      ScalarT min_detA2 = cartesian_sweep(tangent,
+        arg_minimum2, 2, direction2, interval);
+
+      ScalarT min_detA3 = cartesian_sweep(tangent,
+        arg_minimum3, 3, direction3, interval);
+
+      if ( min_detA1 <= min_detA2 && min_detA1 <= min_detA3 ) {
+
+        cartesian_newton_raphson(tangent,
+          arg_minimum1, 1, direction1, min_detA1);
+
+        min_detA = min_detA1;
+        direction = direction1;
+
+      }
+      else if ( min_detA2 <= min_detA1 && min_detA2 <= min_detA3 ) {
+
+        cartesian_newton_raphson(tangent,
+          arg_minimum2, 2, direction2, min_detA2);
+
+        min_detA = min_detA2;
+        direction = direction2;
+
+      }
+      else if ( min_detA3 <= min_detA1 && min_detA3 <= min_detA2 ) {
+
+        cartesian_newton_raphson(tangent,
+          arg_minimum3, 3, direction3, min_detA3);
+
+        min_detA = min_detA3;
+        direction = direction3;
+      }
+
+    }
+    else {
+
+      // Spherical, also the default
+      minitensor::Vector<ScalarT, 2> arg_minimum;
+
+      min_detA = spherical_sweep(tangent, arg_minimum, direction,
+        sweep_interval);
+      if (refine == true) {
+        min_detA = refine_sweep<minitensor::SphericalParametrization<
+          ScalarT, 3>>(tangent, arg_minimum, direction,
+          pi * sweep_interval / 2.0, pi * interval / 2.0);
+      }
+      spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
+    }
+
+    ellipticity_flag_(cell,pt) = min_detA > 0.0 ? 1 : 0;
+    min_detA_(cell,pt) = min_detA;
+
+    for (int i(0); i < num_dims_; ++i) {
+      direction_(cell,pt,i) = direction(i);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  //
+  // Sufficient condition for strong ellipticity.
+  // For unit m, n: m.A(n).m = (m x n):C:(m x n). Writing C as a 9x9 matrix
+  // K on second-order tensors, A(n) >= lambda_min(K) I for all n. K itself
+  // is singular for tangents with minor symmetry, so add t N, where
+  // a:N:a = (tr a)^2 - a:a^T vanishes for every rank-one a. A Cholesky
+  // factorization of sym(K) + t N - eps s I then proves
+  // lambda_min(A(n)) >= eps s, with s the largest diagonal entry.
+  //
+  template<typename EvalT, typename Traits>
+  bool BifurcationCheck<EvalT, Traits>::
+  is_strongly_elliptic(minitensor::Tensor4<ScalarT, 3> const & tangent,
+    ScalarT & lower_bound)
+  {
+    RealType
+    K[9][9];
+
+    RealType
+    scale(0.0);
+
+    RealType
+    shear(0.0);
+
+    for (int i(0); i < 3; ++i) {
+      for (int j(0); j < 3; ++j) {
+        for (int k(0); k < 3; ++k) {
+          for (int l(0); l < 3; ++l) {
+            K[3*i+j][3*k+l] = 0.5 *
+              (Sacado::ScalarValue<ScalarT>::eval(tangent(i,j,k,l)) +
+               Sacado::ScalarValue<ScalarT>::eval(tangent(k,l,i,j)));
+          }
         }
-	    else if (parametrization_type_ == "PSO") {
-	      
-	      minitensor::Vector<ScalarT, 2> arg_minimum;
-		  
-		  min_detA = stereographic_pso(tangent, arg_minimum, direction);
-	    
-	    } 
-	    else if (parametrization_type_ == "Spherical") {
-	      
-	      minitensor::Vector<ScalarT, 2> arg_minimum;
-		  
-		  min_detA = spherical_sweep(tangent, arg_minimum, direction, interval);		  
-		  spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
-	    
-	    } 
-	    else if(parametrization_type_ == "Stereographic") {
-	      
-	      minitensor::Vector<ScalarT, 2> arg_minimum;
-		  
-		  min_detA = stereographic_sweep(tangent, arg_minimum, direction, interval);		  
-		  stereographic_newton_raphson(tangent, arg_minimum, direction, min_detA);
-	    
-	    } 
-	    else if(parametrization_type_ == "Projective") {
-	    
-	      minitensor::Vector<ScalarT, 3> arg_minimum;      
-		  
-		  min_detA = projective_sweep(tangent, arg_minimum, direction, interval);
-		  projective_newton_raphson(tangent, arg_minimum, direction, min_detA);
-	      
-	    } 
-	    else if(parametrization_type_ == "Tangent") {
-	    
-	      minitensor::Vector<ScalarT, 2> arg_minimum;
-		  
-		  min_detA = tangent_sweep(tangent, arg_minimum, direction, interval);		
-		  tangent_newton_raphson(tangent, arg_minimum, direction, min_detA);
-	      
-	    } 
-	    else if(parametrization_type_ == "Cartesian") {
-		
-		  minitensor::Vector<ScalarT, 2> arg_minimum1;
-		  minitensor::Vector<ScalarT, 2> arg_minimum2;
-		  minitensor::Vector<ScalarT, 2> arg_minimum3;
-		  minitensor::Vector<ScalarT, 3> direction1(1.0, 0.0, 0.0);
-		  minitensor::Vector<ScalarT, 3> direction2(0.0, 1.0, 0.0);
-		  minitensor::Vector<ScalarT, 3> direction3(0.0, 0.0, 1.0);
-	      
-		  ScalarT min_detA1 = cartesian_sweep(tangent, 
-		    arg_minimum1, 1, direction1, interval);
-		  
-		  ScalarT min_detA2 = cartesian_sweep(tangent, 
-		    arg_minimum2, 2, direction2, interval);
-		  
-		  ScalarT min_detA3 = cartesian_sweep(tangent, 
-		    arg_minimum3, 3, direction3, interval);
-		  
-		  if ( min_detA1 <= min_detA2 && min_detA1 <= min_detA3 ) {
-		  
-		    cartesian_newton_raphson(tangent, 
-		      arg_minimum1, 1, direction1, min_detA1);
-		  
-		    min_detA = min_detA1;
-		    direction = direction1;
-		  
-		  }
-		  else if ( min_detA2 <= min_detA1 && min_detA2 <= min_detA3 ) {
-		  
-		    cartesian_newton_raphson(tangent, 
-		      arg_minimum2, 2, direction2, min_detA2);
-		  
-		    min_detA = min_detA2;
-		    direction = direction2;
-		  
-		  }
-		  else if ( min_detA3 <= min_detA1 && min_detA3 <= min_detA2 ) {
-		  
-		  	cartesian_newton_raphson(tangent, 
-		  	  arg_minimum3, 3, direction3, min_detA3);
-		  
-		    min_detA = min_detA3;		  
-		    direction = direction3;
-		  }
-	      
-	    } 
-	    else {
-	    
-	      minitensor::Vector<ScalarT, 2> arg_minimum;
-		  
-		  min_detA = spherical_sweep(tangent, arg_minimum, direction, interval);		
-		  spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
-	    }
-        
-        ellipticity_flag = true;
-        if(min_detA <= 0.0) ellipticity_flag = false;
+        scale = std::max(scale, K[3*i+j][3*i+j]);
+        if (i != j) shear += K[3*i+j][3*i+j] / 6.0;
+      }
+    }
 
-        ellipticity_flag_(cell,pt) = ellipticity_flag;
-        min_detA_(cell,pt) = min_detA;
-        
-        //std::cout << "\n" << min_detA << " @ " << direction << std::endl;
+    if (scale <= 0.0) return false;
+
+    RealType const
+    eps = screening_tolerance_;
 
-        for (int i(0); i < num_dims_; ++i) {
-          direction_(cell,pt,i) = direction(i);
+    // t = 0 covers tangents without minor symmetry, t = shear the
+    // (near-)isotropic ones.
+    RealType const
+    shifts[2] = {shear, 0.0};
+
+    for (int s(0); s < 2; ++s) {
+      RealType
+      L[9][9];
+
+      for (int r(0); r < 9; ++r) {
+        for (int c(0); c < 9; ++c) {
+          int const i = r / 3, j = r % 3, k = c / 3, l = c % 3;
+          RealType const
+          N = (i == j && k == l ? 1.0 : 0.0) - (i == l && j == k ? 1.0 : 0.0);
+          L[r][c] = K[r][c] + shifts[s] * N - (r == c ? eps * scale : 0.0);
         }
-        
+      }
+
+      bool
+      positive = true;
+
+      for (int c(0); c < 9 && positive == true; ++c) {
+        RealType
+        d = L[c][c];
+        for (int q(0); q < c; ++q) d -= L[c][q] * L[c][q];
+        if (d <= 0.0) {
+          positive = false;
+          break;
+        }
+        L[c][c] = std::sqrt(d);
+        for (int r(c + 1); r < 9; ++r) {
+          RealType
+          v = L[r][c];
+          for (int q(0); q < c; ++q) v -= L[r][q] * L[c][q];
+          L[r][c] = v / L[c][c];
+        }
+      }
+
+      if (positive == true) {
+        lower_bound = eps * scale;
+        return true;
       }
     }
-    
+
+    return false;
   }
-  
+
+  //----------------------------------------------------------------------------
+  //
+  // Refine a grid minimum: halve the spacing and traverse a 5-point-per-
+  // direction grid centred on the current minimum until the spacing
+  // reaches the fine spacing.
+  //
+  template<typename EvalT, typename Traits>
+  template<typename Parametrization, minitensor::Index P>
+  typename EvalT::ScalarT BifurcationCheck<EvalT, Traits>::
+  refine_sweep(minitensor::Tensor4<ScalarT, 3> const & tangent,
+    minitensor::Vector<ScalarT, P> & arg_minimum,
+    minitensor::Vector<ScalarT, 3> & direction,
+    ScalarT spacing, ScalarT const & fine_spacing)
+  {
+    Parametrization
+    param(tangent);
+
+    while (spacing > fine_spacing) {
+
+      spacing = spacing / 2.0;
+
+      minitensor::Vector<ScalarT, P>
+      grid_min;
+
+      minitensor::Vector<ScalarT, P>
+      grid_max;
+
+      minitensor::Vector<minitensor::Index, P>
+      grid_num_points;
+
+      for (minitensor::Index i(0); i < P; ++i) {
+        grid_min(i) = arg_minimum(i) - 2.0 * spacing;
+        grid_max(i) = arg_minimum(i) + 2.0 * spacing;
+        grid_num_points(i) = 5;
+      }
+
+      minitensor::ParametricGrid<ScalarT, P>
+      grid(grid_min, grid_max, grid_num_points);
+
+      grid.traverse(param);
+
+      for (minitensor::Index i(0); i < P; ++i) {
+        arg_minimum(i) = (param.get_arg_minimum())(i);
+      }
+    }
+
+    for (int i(0); i < 3; ++i) {
+      direction(i) = (param.get_normal_minimum())(i);
+    }
+
+    return param.get_minimum();
+  }
+
   //----------------------------------------------------------------------------
   template<typename EvalT, typename Traits>
   typename EvalT::ScalarT BifurcationCheck<EvalT, Traits>::
@@ -9,6 +9,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
+#include "PHAL_Utilities.hpp"
 
 // **********************************************************************
 // Genereric Template Code for Constructor and PostRegistrationSetup
@@ -235,12 +236,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   double* coord;
 
   ScalarT Xval, Yval; 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1);
-  size_t numEntriesT;
-  value[0] = j_coeff;
   Teuchos::Array<ST> matrixEntriesT;
-  Teuchos::Array<LO> matrixIndicesT;
 
 
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) 
@@ -252,27 +248,11 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
     this->computeBCs(coord, Xval, Yval, time);
     
     // replace jac values for the X dof 
-    numEntriesT = jacT->getNumEntriesInLocalRow(xlunk);
-    matrixEntriesT.resize(numEntriesT);
-    matrixIndicesT.resize(numEntriesT);
-    jacT->getLocalRowCopy(xlunk, matrixIndicesT(), matrixEntriesT(), numEntriesT);
-    for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-    jacT->replaceLocalValues(xlunk, matrixIndicesT(), matrixEntriesT());
-
-    index[0] = xlunk;
-    jacT->replaceLocalValues(xlunk, index(), value());
+    PHAL::setDirichletRowT(*jacT, xlunk, j_coeff, matrixEntriesT);
 
 
     // replace jac values for the y dof
-    numEntriesT = jacT->getNumEntriesInLocalRow(ylunk);
-    matrixEntriesT.resize(numEntriesT);
-    matrixIndicesT.resize(numEntriesT);
-    jacT->getLocalRowCopy(ylunk, matrixIndicesT(), matrixEntriesT(), numEntriesT);
-    for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-    jacT->replaceLocalValues(ylunk, matrixIndicesT(), matrixEntriesT());
-
-    index[0] = ylunk;
-    jacT->replaceLocalValues(ylunk, index(), value());    
+    PHAL::setDirichletRowT(*jacT, ylunk, j_coeff, matrixEntriesT);
 
 
     if (fillResid)
@@ -8,6 +8,7 @@
 #include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "MiniTensor.h"
+#include "PHAL_Utilities.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Teuchos_TestForException.hpp"
@@ -609,16 +610,16 @@ fillResidual(SchwarzBC & sbc, typename Traits::EvalData dirichlet_workset)
     auto const
     dof = x_dof / 3;
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
       fT_view[x_dof] = xT_const_view[x_dof] - schwarz_bcs_const_view_x[dof];
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
       fT_view[y_dof] = xT_const_view[y_dof] - schwarz_bcs_const_view_y[dof];
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
       fT_view[z_dof] = xT_const_view[z_dof] - schwarz_bcs_const_view_z[dof];
     }
 
@@ -640,16 +641,16 @@ fillResidual(SchwarzBC & sbc, typename Traits::EvalData dirichlet_workset)
     auto const
     z_dof = ns_dof[ns_node][2];
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
       fT_view[x_dof] = xT_const_view[x_dof] - x_val;
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
       fT_view[y_dof] = xT_const_view[y_dof] - y_val;
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
       fT_view[z_dof] = xT_const_view[z_dof] - z_val;
     }
 
@@ -719,20 +720,9 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
   std::vector<std::vector<int>> const &
   ns_nodes = dirichlet_workset.nodeSets->find(this->nodeSetID)->second;
 
-  Teuchos::Array<LO>
-  index(1);
-
-  Teuchos::Array<ST>
-  value(1);
-
-  value[0] = j_coeff;
-
   Teuchos::Array<ST>
   matrix_entries;
 
-  Teuchos::Array<LO>
-  matrix_indices;
-
   bool const
   fill_residual = (fT != Teuchos::null);
 
@@ -751,76 +741,22 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
     auto const
     z_dof = ns_nodes[ns_node][2];
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
       // replace jac values for the X dof
-      auto
-      num_entries = jacT->getNumEntriesInLocalRow(x_dof);
-
-      matrix_entries.resize(num_entries);
-      matrix_indices.resize(num_entries);
-
-      jacT->getLocalRowCopy(
-          x_dof,
-          matrix_indices(),
-          matrix_entries(),
-          num_entries);
-
-      for (auto i = 0; i < num_entries; ++i) {
-        matrix_entries[i] = 0;
-      }
-
-      jacT->replaceLocalValues(x_dof, matrix_indices(), matrix_entries());
-      index[0] = x_dof;
-      jacT->replaceLocalValues(x_dof, index(), value());
+      PHAL::setDirichletRowT(*jacT, x_dof, j_coeff, matrix_entries);
     }
 
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
       // replace jac values for the y dof
-      auto
-      num_entries = jacT->getNumEntriesInLocalRow(y_dof);
-
-      matrix_entries.resize(num_entries);
-      matrix_indices.resize(num_entries);
-
-      jacT->getLocalRowCopy(
-          y_dof,
-          matrix_indices(),
-          matrix_entries(),
-          num_entries);
-
-      for (auto i = 0; i < num_entries; ++i) {
-        matrix_entries[i] = 0;
-      }
-
-      jacT->replaceLocalValues(y_dof, matrix_indices(), matrix_entries());
-      index[0] = y_dof;
-      jacT->replaceLocalValues(y_dof, index(), value());
+      PHAL::setDirichletRowT(*jacT, y_dof, j_coeff, matrix_entries);
     }
 
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
       // replace jac values for the z dof
-      auto
-      num_entries = jacT->getNumEntriesInLocalRow(z_dof);
-
-      matrix_entries.resize(num_entries);
-      matrix_indices.resize(num_entries);
-
-      jacT->getLocalRowCopy(
-          z_dof,
-          matrix_indices(),
-          matrix_entries(),
-          num_entries);
-
-      for (auto i = 0; i < num_entries; ++i) {
-        matrix_entries[i] = 0;
-      }
-
-      jacT->replaceLocalValues(z_dof, matrix_indices(), matrix_entries());
-      index[0] = z_dof;
-      jacT->replaceLocalValues(z_dof, index(), value());
+      PHAL::setDirichletRowT(*jacT, z_dof, j_coeff, matrix_entries);
     }
   }
 
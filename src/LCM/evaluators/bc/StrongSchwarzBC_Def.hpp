@@ -603,18 +603,18 @@ fillResidual(StrongSchwarzBC & sbc, typename Traits::EvalData dirichlet_workset)
     auto const
     dof = x_dof / 3;
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
       f_view[x_dof] = 0.0;
       x_view[x_dof] = schwarz_bcs_const_view_x[dof];
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
       f_view[y_dof] = 0.0;
       x_view[y_dof] = schwarz_bcs_const_view_y[dof];
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
       f_view[z_dof] = 0.0;
       x_view[z_dof] = schwarz_bcs_const_view_z[dof];
     }
@@ -637,18 +637,18 @@ fillResidual(StrongSchwarzBC & sbc, typename Traits::EvalData dirichlet_workset)
     auto const
     z_dof = ns_nodes[ns_node][2];
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
       f_view[x_dof] = 0.0;
       x_view[x_dof] = x_val;
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
       f_view[y_dof] = 0.0;
       x_view[y_dof] = y_val;
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
       f_view[z_dof] = 0.0;
       x_view[z_dof] = z_val;
     }
@@ -754,10 +754,10 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
     size_t const
     num_rows = J->getNodeNumRows();
 
-    std::set<int> const &
+    PHAL::DofMask const &
     fixed_dofs = dirichlet_workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(x_dof)) {
        
       GO const global_x_dof = Map->getGlobalElement(x_dof);  
       marker[global_x_dof] += 1.0;  
@@ -787,7 +787,7 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       }
     }
 
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(y_dof)) {
 
       GO const global_y_dof = Map->getGlobalElement(y_dof);  
       marker[global_y_dof] += 1.0;  
@@ -817,7 +817,7 @@ evaluateFields(typename Traits::EvalData dirichlet_workset)
       }
     }
 
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (!fixed_dofs.contains(z_dof)) {
 
       GO const global_z_dof = Map->getGlobalElement(z_dof);  
       marker[global_z_dof] += 1.0;  
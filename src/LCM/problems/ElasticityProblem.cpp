@@ -111,6 +111,7 @@ Albany::ElasticityProblem::constructDirichletEvaluators(
                                        this->params, this->paramLib);
   use_sdbcs_ = dirUtils.useSDBCs(); 
   offsets_ = dirUtils.getOffsets(); 
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
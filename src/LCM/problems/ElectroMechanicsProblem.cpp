@@ -133,6 +133,7 @@ constructDirichletEvaluators(const Albany::MeshSpecsStruct& meshSpecs)
   dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
       this->params, this->paramLib);
   offsets_ = dirUtils.getOffsets(); 
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 //------------------------------------------------------------------------------
 // Traction BCs
@@ -124,6 +124,7 @@ Albany::HMCProblem::constructDirichletEvaluators(
                                        this->params, this->paramLib);
   use_sdbcs_ = dirUtils.useSDBCs(); 
   offsets_ = dirUtils.getOffsets(); 
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
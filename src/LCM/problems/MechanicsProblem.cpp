@@ -397,6 +397,7 @@ Albany::MechanicsProblem::constructDirichletEvaluators(
 
   use_sdbcs_ = dirUtils.useSDBCs(); 
   offsets_ = dirUtils.getOffsets();
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 //------------------------------------------------------------------------------
 // Neumann BCs
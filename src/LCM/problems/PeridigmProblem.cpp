@@ -112,6 +112,7 @@ Albany::PeridigmProblem::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames, this->params, this->paramLib);
    use_sdbcs_ = dirUtils.useSDBCs(); 
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 void
@@ -217,6 +217,7 @@ constructDirichletEvaluators(const Albany::MeshSpecsStruct & mesh_specs)
       this->paramLib);
 
   offsets_ = dirichlet_utils.getOffsets();
+  dirichletRowOffsets_ = dirichlet_utils.getDirichletRowOffsets();
 
   return;
 }
@@ -102,6 +102,7 @@ Albany::ThermoElasticityProblem::constructDirichletEvaluators(
                                        this->params, this->paramLib);
   use_sdbcs_ = dirUtils.useSDBCs(); 
   offsets_ = dirUtils.getOffsets(); 
+  dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 Teuchos::RCP<const Teuchos::ParameterList>
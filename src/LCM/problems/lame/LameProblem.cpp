@@ -101,6 +101,7 @@ Albany::LameProblem::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 Teuchos::RCP<const Teuchos::ParameterList>
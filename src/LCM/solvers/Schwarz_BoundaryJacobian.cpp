@@ -63,19 +63,26 @@ Teuchos::RCP<Tpetra_CrsMatrix>
 Schwarz_BoundaryJacobian::
 getExplicitOperator() const
 {
-  auto const
-  max_num_cols = getDomainMap()->getNodeNumElements();
+  // The coupling is zero: its graph has no entries, rather than a dense
+  // row for every local column. The graph is built once for the maps.
+  bool const
+  same_maps = graph_.is_null() == false &&
+      graph_->getRangeMap() == getRangeMap() &&
+      graph_->getDomainMap() == getDomainMap();
 
-  Teuchos::RCP<Tpetra_CrsMatrix>
-  K = Teuchos::rcp(
-      new Tpetra_CrsMatrix(getRangeMap(), getDomainMap(), max_num_cols));
+  if (same_maps == false) {
+    Teuchos::RCP<Tpetra_CrsGraph>
+    graph = Teuchos::rcp(
+        new Tpetra_CrsGraph(getRangeMap(), 0, Tpetra::StaticProfile));
 
-  auto const
-  zero = Teuchos::ScalarTraits<ST>::zero();
+    graph->fillComplete(getDomainMap(), getRangeMap());
+    graph_ = graph;
+  }
 
-  K->setAllToScalar(zero);
+  Teuchos::RCP<Tpetra_CrsMatrix>
+  K = Teuchos::rcp(new Tpetra_CrsMatrix(graph_));
 
-  K->fillComplete();
+  K->fillComplete(getDomainMap(), getRangeMap());
 
   return K;
 }
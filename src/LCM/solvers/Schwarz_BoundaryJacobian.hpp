@@ -60,6 +60,20 @@ public:
   Teuchos::RCP<Tpetra_CrsMatrix>
   getExplicitOperator() const;
 
+  /// Graph of the explicit operator. A graph kept from an earlier operator
+  /// on the same maps is reused; otherwise a new one is built.
+  void
+  setExplicitGraph(Teuchos::RCP<Tpetra_CrsGraph const> const & graph)
+  {
+    graph_ = graph;
+  }
+
+  Teuchos::RCP<Tpetra_CrsGraph const>
+  getExplicitGraph() const
+  {
+    return graph_;
+  }
+
   /// Returns the current UseTranspose setting.
   virtual
   bool
@@ -143,6 +157,9 @@ private:
   Teuchos::RCP<Tpetra_Map const>
   range_map_;
 
+  mutable Teuchos::RCP<Tpetra_CrsGraph const>
+  graph_;
+
   Teuchos::RCP<Teuchos_Comm const>
   comm_;
 
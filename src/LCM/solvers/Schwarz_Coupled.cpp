@@ -36,6 +36,8 @@ SchwarzCoupled(
 {
   comm_ = comm;
 
+  coupled_jac_ = Teuchos::rcp(new Schwarz_CoupledJacobian(comm_));
+
   lowsfb_ = lowsfb;
 
   //IK, 2/11/15: I am assuming for now we don't have any distributed parameters.
@@ -716,10 +718,7 @@ SchwarzCoupled::getUpperBounds() const
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 SchwarzCoupled::create_W_op() const
 {
-  Schwarz_CoupledJacobian
-  jac(comm_);
-
-  return jac.getThyraCoupledJacobian(jacs_, apps_);
+  return coupled_jac_->getThyraCoupledJacobian(jacs_, apps_);
 }
 
 Teuchos::RCP<Thyra::PreconditionerBase<ST>>
@@ -730,13 +729,11 @@ SchwarzCoupled::create_W_prec() const
 
   ALBANY_ASSERT(w_prec_supports_ == true);
 
-  Schwarz_CoupledJacobian jac(comm_);
   for (auto m = 0; m < num_models_; m++) {
     if (precs_[m]->isFillActive()) precs_[m]->fillComplete();
   }
-  Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op = jac.getThyraCoupledJacobian(
-      precs_,
-      apps_);
+  Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op =
+      coupled_jac_->getThyraCoupledJacobian(precs_, apps_);
   W_prec->initializeRight(W_op);
 
   return W_prec;
@@ -1017,8 +1014,7 @@ evalModelImpl(
       fs_already_computed[m] = true;
     }
     // FIXME: create coupled W matrix from array of model W matrices
-    Schwarz_CoupledJacobian jac(comm_);
-    W_op_outT = jac.getThyraCoupledJacobian(jacs_, apps_);
+    W_op_outT = coupled_jac_->getThyraCoupledJacobian(jacs_, apps_);
   }
 
   for (auto m = 0; m < num_models_; ++m) {
@@ -1124,13 +1120,12 @@ evalModelImpl(
               ->get1dViewNonConst();
           //Compute abs sum of each row and store in absrowsum vector 
           for (auto i = 0; i < jacs_[m]->getNodeNumRows(); ++i) {
-            std::size_t NumEntries = jacs_[m]->getNumEntriesInLocalRow(i);
-            Teuchos::Array<LO> Indices(NumEntries);
-            Teuchos::Array<ST> Values(NumEntries);
-            //Get local row
-            jacs_[m]->getLocalRowCopy(i, Indices(), Values(), NumEntries);
+            Teuchos::ArrayView<const LO> Indices;
+            Teuchos::ArrayView<const ST> Values;
+            //View local row, the Jacobian is fill complete here
+            jacs_[m]->getLocalRowView(i, Indices, Values);
             //Compute abs row rum 
-            for (auto j = 0; j < NumEntries; j++)
+            for (auto j = 0; j < Values.size(); j++)
               absrowsum_nonconstView[i] += std::abs(Values[j]);
           }
           //Invert absrowsum 
@@ -1172,9 +1167,8 @@ evalModelImpl(
         if (precs_[m]->isFillActive())
           precs_[m]->fillComplete();
       }
-      Schwarz_CoupledJacobian jac(comm_);
       Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op =
-          jac.getThyraCoupledJacobian(precs_, apps_);
+          coupled_jac_->getThyraCoupledJacobian(precs_, apps_);
       Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec = Teuchos::rcp(
           new Thyra::DefaultPreconditioner<ST>);
       W_prec->initializeRight(W_op);
@@ -10,6 +10,7 @@
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DataTypes.hpp"
 #include "Schwarz_BoundaryJacobian.hpp" 
+#include "Schwarz_CoupledJacobian.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
 #include "Albany_MaterialDatabase.hpp"
@@ -171,6 +172,11 @@ private:
   Teuchos::Array<Teuchos::RCP<Tpetra_CrsMatrix>>
   precs_;
 
+  /// Builds the coupled Jacobian and preconditioner operators, keeping the
+  /// graphs of the off-diagonal blocks across evaluations
+  Teuchos::RCP<Schwarz_CoupledJacobian>
+  coupled_jac_;
+
   int
   num_models_;
 
@@ -84,9 +84,15 @@ const
             Teuchos::rcp(
                 new Schwarz_BoundaryJacobian(comm_, ca, jacs, i, j));
 
+        boundary_graphs_.resize(block_dim * block_dim);
+
+        jac_boundary->setExplicitGraph(boundary_graphs_[i * block_dim + j]);
+
         Teuchos::RCP<Tpetra_CrsMatrix>
         exp_jac = jac_boundary->getExplicitOperator();
 
+        boundary_graphs_[i * block_dim + j] = jac_boundary->getExplicitGraph();
+
         Teuchos::RCP<Thyra::LinearOpBase<ST>>
         block = Thyra::createLinearOp<ST, LO, GO, KokkosNode>(exp_jac);
 
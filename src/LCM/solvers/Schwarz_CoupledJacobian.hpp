@@ -40,6 +40,11 @@ private:
 
   Teuchos::RCP<Teuchos_Comm const>
   comm_;
+
+  /// Graphs of the explicit off-diagonal blocks, row by row, kept across
+  /// evaluations
+  mutable Teuchos::Array<Teuchos::RCP<Tpetra_CrsGraph const>>
+  boundary_graphs_;
 };
 
 } //namespace LCM
@@ -404,6 +404,12 @@ int main(int ac, char* av[])
     bcPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
     bcPL.set<std::string>("Parametrization Type Name", parametrization_type);
     bcPL.set<double>("Parametrization Interval Name", parametrization_interval);
+    bcPL.set<double>("Coarse Parametrization Interval",
+        mpsParams.get<double>("Coarse Parametrization Interval", 0.0));
+    bcPL.set<bool>("Ellipticity Screening",
+        mpsParams.get<bool>("Ellipticity Screening", false));
+    bcPL.set<double>("Screening Tolerance",
+        mpsParams.get<double>("Screening Tolerance", 1.0e-2));
     bcPL.set<std::string>("Material Tangent Name", "Material Tangent");
     bcPL.set<std::string>("Ellipticity Flag Name", "Ellipticity_Flag");
     bcPL.set<std::string>("Bifurcation Direction Name", "Direction");
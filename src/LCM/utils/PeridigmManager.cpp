@@ -7,10 +7,12 @@
 /*! \file PeridigmManager.cpp */
 
 #include "PeridigmManager.hpp"
-#include "Peridigm_ProximitySearch.hpp"
 #include "Albany_Utils.hpp"
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/FieldBase.hpp>
+#include <stk_search/CoarseSearch.hpp>
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
 #include "Phalanx_DataLayout.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "PHAL_Dimension.hpp"
@@ -20,6 +22,9 @@
 #include <Epetra_Export.h>
 #include "Phalanx_KokkosViewFactory.hpp"
 #include "Phalanx_MDField.hpp"
+#include <algorithm>
+#include <limits>
+#include <set>
 
 //#define HARD_CODED_BODY_FORCE_PERIDIGM_MANAGER
 
@@ -40,7 +45,7 @@ void LCM::PeridigmManager::initializeSingleton(
   }
 }
 
-LCM::PeridigmManager::PeridigmManager() : hasPeridynamics(false), enableOptimizationBasedCoupling(false), obcScaleFactor(1.0), previousTime(0.0), currentTime(0.0), timeStep(0.0), cubatureDegree(-1)
+LCM::PeridigmManager::PeridigmManager() : hasPeridynamics(false), enableOptimizationBasedCoupling(false), obcScaleFactor(1.0), obcSearchTolerance(0.01), previousTime(0.0), currentTime(0.0), timeStep(0.0), cubatureDegree(-1)
 {}
 
 void LCM::PeridigmManager::initialize(const Teuchos::RCP<Teuchos::ParameterList>& params,
@@ -61,6 +66,7 @@ void LCM::PeridigmManager::initialize(const Teuchos::RCP<Teuchos::ParameterList>
   if(peridigmParams->isSublist("Optimization Based Coupling")){
     enableOptimizationBasedCoupling = true;
     obcScaleFactor = peridigmParams->sublist("Optimization Based Coupling").get<double>("Functional Scale Factor", 1.0);
+    obcSearchTolerance = peridigmParams->sublist("Optimization Based Coupling").get<double>("Search Tolerance", 0.01);
   }
 
   // Read the material data base file, if any
@@ -499,12 +505,7 @@ void LCM::PeridigmManager::initialize(const Teuchos::RCP<Teuchos::ParameterList>
 
 void LCM::PeridigmManager::obcOverlappingElementSearch()
 {
-  static bool searchComplete = false;
-  if(searchComplete){
-    std::cout << "DJL DEBUGGING PeridigmManager::obcOverlappingElementSearch() is being called more than once!" << std::endl;
-  }
-  searchComplete = true;
-
+  // The search may be repeated (e.g. after the mesh has changed), so start from scratch
   obcDataPoints = Teuchos::rcp(new std::vector<OBCDataPoint>());
 
   stk::mesh::Field<double,stk::mesh::Cartesian3d>* coordinatesField = 
@@ -523,141 +524,127 @@ void LCM::PeridigmManager::obcOverlappingElementSearch()
   std::vector<stk::mesh::Entity> elements;
   stk::mesh::get_selected_entities(local_elem_selector, bulkData->buckets(stk::topology::ELEMENT_RANK), elements);
 
-  // Collect data for the proximity search and for filling OBCDataPoint structures downstream
-  std::vector<double> proximitySearchCoords(3*elements.size(), 0.0);
-  std::vector<double> proximitySearchRadii(elements.size(), 0.0);
-  std::vector<int> proximitySearchGlobalElemIds(elements.size());
-  double maxProximitySearchRadius(0.0);
+  // Collect the bounding boxes of the solid elements (search domain) and the
+  // positions of the sphere elements (search range).  The boxes are padded by
+  // obcSearchTolerance times the largest box dimension so that points on an
+  // element face are not missed.
+  typedef stk::search::IdentProc<stk::mesh::EntityId, int> SearchIdent;
+  typedef stk::search::Box<double> SearchBox;
+  typedef stk::search::Sphere<double> SearchSphere;
+  int myRank = teuchosComm->getRank();
+  std::vector< std::pair<SearchBox, SearchIdent> > solidElementBoxes;
+  std::vector< std::pair<SearchSphere, SearchIdent> > sphereElementPoints;
+  std::vector<int> sphereGlobalElemIds;
+  std::vector<double> sphereCoords;
+  std::vector<double> sphereVolumes;
+  std::vector<int> sphereNodeIds;
   for(unsigned int iElem=0 ; iElem<elements.size() ; ++iElem){
-    proximitySearchGlobalElemIds[iElem] = bulkData->identifier(elements[iElem]) - 1;
+    stk::mesh::EntityId elemId = bulkData->identifier(elements[iElem]);
     int numNodes = bulkData->num_nodes(elements[iElem]);
     const stk::mesh::Entity* nodes = bulkData->begin_nodes(elements[iElem]);
     if(numNodes == 1){
-      // If the element is a sphere element, include its node in the search and set the search radius to a small number
       double* coord = stk::mesh::field_data(*coordinatesField, nodes[0]);
       double* volume = stk::mesh::field_data(*volumeField, elements[iElem]);
+      SearchSphere sphere(stk::search::Point<double>(coord[0], coord[1], coord[2]), 0.0);
+      sphereElementPoints.push_back(std::make_pair(sphere, SearchIdent(elemId, myRank)));
+      sphereGlobalElemIds.push_back(static_cast<int>(elemId) - 1);
       for(int dof=0 ; dof<3 ; ++dof){
-	proximitySearchCoords[3*iElem+dof] = coord[dof];
-      }
-      // DJL there is a bug in the proximity search, it doesn't work properly in parallel if the radius is set to 0.0.
-      // So, set it to some small number, like a 1/1000 times the cube root of the volume.
-      proximitySearchRadii[iElem] = 0.001 * std::cbrt(volume[0]);
-      if(proximitySearchRadii[iElem] > maxProximitySearchRadius){
-	maxProximitySearchRadius = proximitySearchRadii[iElem];
+        sphereCoords.push_back(coord[dof]);
       }
+      sphereVolumes.push_back(volume[0]);
+      sphereNodeIds.push_back(static_cast<int>( bulkData->identifier(nodes[0]) - 1 ));
     }
     else{
-      // If the element is not a sphere element, use its barycenter in the proximity search and set
-      // the search radius to be slightly larger than the largest element dimension
-      double radiusMultiplier = 1.5;
-      double largestElementDimensionSquared = 0.0;
-      for(int i=0 ; i<numNodes ; ++i){
-	double* pt1 = stk::mesh::field_data(*coordinatesField, nodes[i]);
-	for(int dof=0 ; dof<3 ; ++dof){
-	  proximitySearchCoords[3*iElem+dof] += pt1[dof];
-	}
-	for(int j=i+1 ; j<numNodes ; ++j){
-	  double* pt2 = stk::mesh::field_data(*coordinatesField, nodes[j]);
-	  double distanceSquared = (pt1[0]-pt2[0])*(pt1[0]-pt2[0]) + (pt1[1]-pt2[1])*(pt1[1]-pt2[1]) + (pt1[2]-pt2[2])*(pt1[2]-pt2[2]);
-	  if(distanceSquared > largestElementDimensionSquared){
-	    largestElementDimensionSquared = distanceSquared;
-	  }
-	}
+      double minCoord[3], maxCoord[3];
+      for(int dof=0 ; dof<3 ; ++dof){
+        minCoord[dof] = std::numeric_limits<double>::max();
+        maxCoord[dof] = -std::numeric_limits<double>::max();
       }
-      for(int dof=0 ; dof<3 ; dof++){
-	proximitySearchCoords[3*iElem+dof] /= numNodes;
+      for(int i=0 ; i<numNodes ; ++i){
+        double* pt = stk::mesh::field_data(*coordinatesField, nodes[i]);
+        for(int dof=0 ; dof<3 ; ++dof){
+          minCoord[dof] = std::min(minCoord[dof], pt[dof]);
+          maxCoord[dof] = std::max(maxCoord[dof], pt[dof]);
+        }
       }
-      proximitySearchRadii[iElem] = radiusMultiplier * std::sqrt(largestElementDimensionSquared);
-      if(proximitySearchRadii[iElem] > maxProximitySearchRadius){
-	maxProximitySearchRadius = proximitySearchRadii[iElem];
+      double padding = 0.0;
+      for(int dof=0 ; dof<3 ; ++dof){
+        padding = std::max(padding, obcSearchTolerance*(maxCoord[dof] - minCoord[dof]));
       }
+      SearchBox box(minCoord[0] - padding, minCoord[1] - padding, minCoord[2] - padding,
+                    maxCoord[0] + padding, maxCoord[1] + padding, maxCoord[2] + padding);
+      solidElementBoxes.push_back(std::make_pair(box, SearchIdent(elemId, myRank)));
     }
   }
 
-  // This is a work-around for an apparent bug in the proximity search
-  // There appears to be a glitch when many nodes have zero neighbors, so use a larger
-  // search radius than needed
-  vector<double> localValDouble(1), globalValDouble(1);
-  localValDouble[0] = maxProximitySearchRadius;
-  Teuchos::reduceAll(*teuchosComm, Teuchos::REDUCE_MAX, 1, &localValDouble[0], &globalValDouble[0]);
-  maxProximitySearchRadius = globalValDouble[0];
-  for(unsigned int i=0 ; i<proximitySearchRadii.size() ; i++){
-    proximitySearchRadii[i] = maxProximitySearchRadius;
+  // Parallel search over a bounding volume tree: each rank receives the
+  // (solid element, sphere element) pairs whose boxes intersect, including
+  // the sphere elements owned by other ranks
+  std::vector< std::pair<SearchIdent, SearchIdent> > searchResults;
+  stk::search::coarse_search(solidElementBoxes, sphereElementPoints, stk::search::KDTREE, bulkData->parallel(), searchResults);
+
+  // Keep the candidates for the solid elements owned by this rank, grouped by element
+  std::map< stk::mesh::EntityId, std::vector<int> > candidateSphereElemIds;
+  std::set<int> overlapSphereGlobalElemIds(sphereGlobalElemIds.begin(), sphereGlobalElemIds.end());
+  for(unsigned int i=0 ; i<searchResults.size() ; ++i){
+    if(searchResults[i].first.proc() != myRank){
+      continue;
+    }
+    int sphereElemId = static_cast<int>(searchResults[i].second.id()) - 1;
+    candidateSphereElemIds[searchResults[i].first.id()].push_back(sphereElemId);
+    overlapSphereGlobalElemIds.insert(sphereElemId);
   }
 
   Teuchos::RCP<Epetra_Comm> epetraComm =  Albany::createEpetraCommFromTeuchosComm(teuchosComm);
 
-  // Create Epetra_BlockMaps for the Peridigm proximity search
+  // Maps for the sphere elements owned by this rank and for the owned and
+  // candidate sphere elements, used to ghost the candidates' data
+  std::vector<int> overlapIds(overlapSphereGlobalElemIds.begin(), overlapSphereGlobalElemIds.end());
   Epetra_BlockMap epetraOneDimensionalMap(-1,
-					  static_cast<int>( elements.size() ),
-					  &proximitySearchGlobalElemIds[0],
+					  static_cast<int>( sphereGlobalElemIds.size() ),
+					  sphereGlobalElemIds.data(),
 					  1,
 					  0,
 					  *epetraComm);
   Epetra_BlockMap epetraThreeDimensionalMap(-1,
-					    static_cast<int>( elements.size() ),
-					    &proximitySearchGlobalElemIds[0],
+					    static_cast<int>( sphereGlobalElemIds.size() ),
+					    sphereGlobalElemIds.data(),
 					    3,
 					    0,
 					    *epetraComm);
-
-  // Input for proximity search routine
-  Teuchos::RCP<Epetra_Vector> epetraProximitySearchCoords = Teuchos::rcp(new Epetra_Vector(epetraThreeDimensionalMap));
-  Teuchos::RCP<Epetra_Vector> epetraProximitySearchRadii = Teuchos::rcp(new Epetra_Vector(epetraOneDimensionalMap));
-  for(unsigned int iElem=0 ; iElem<elements.size() ; ++iElem){
-    for(int dof=0 ; dof<3 ; dof++){
-      (*epetraProximitySearchCoords)[3*iElem+dof] = proximitySearchCoords[3*iElem+dof];
-    }
-    (*epetraProximitySearchRadii)[iElem] = proximitySearchRadii[iElem];
-  }
-
-  // Output from proximity search routine
-  Teuchos::RCP<Epetra_BlockMap> epetraOneDimensionalOverlapMap;
-  int neighborListSize(0);
-  int* neighborList(0);
-
-  // Call the Peridigm proximity search routine
-  PeridigmNS::ProximitySearch::GlobalProximitySearch(epetraProximitySearchCoords,
-						     epetraProximitySearchRadii,
-						     epetraOneDimensionalOverlapMap,
-						     neighborListSize,
-						     neighborList);
-
-  // Create a three-dimensional version of the overlap map
-  Epetra_BlockMap epetraThreeDimensionalOverlapMap(epetraOneDimensionalOverlapMap->NumGlobalElements(),
-						   epetraOneDimensionalOverlapMap->NumMyElements(),
-						   epetraOneDimensionalOverlapMap->MyGlobalElements(),
+  Epetra_BlockMap epetraOneDimensionalOverlapMap(-1,
+						 static_cast<int>( overlapIds.size() ),
+						 overlapIds.data(),
+						 1,
+						 0,
+						 *epetraComm);
+  Epetra_BlockMap epetraThreeDimensionalOverlapMap(-1,
+						   static_cast<int>( overlapIds.size() ),
+						   overlapIds.data(),
 						   3,
 						   0,
 						   *epetraComm);
 
-  // Ghost information for off-processor points
-  Teuchos::RCP<Epetra_Vector> epetraSphereVolume = Teuchos::rcp(new Epetra_Vector(epetraOneDimensionalMap));
-  Teuchos::RCP<Epetra_Vector> epetraSphereNodeId = Teuchos::rcp(new Epetra_Vector(epetraOneDimensionalMap));
-  for(unsigned int iElem=0 ; iElem<elements.size() ; ++iElem){
-    int elemId = bulkData->identifier(elements[iElem]) - 1;
-    int numNodes = bulkData->num_nodes(elements[iElem]);
-    const stk::mesh::Entity* nodes = bulkData->begin_nodes(elements[iElem]);
-    if(numNodes == 1){
-      double* volume = stk::mesh::field_data(*volumeField, elements[iElem]);
-      (*epetraSphereVolume)[iElem] = volume[0];
-      (*epetraSphereNodeId)[iElem] = static_cast<double>( bulkData->identifier(nodes[0]) - 1 );
-    }
-    else{
-      (*epetraSphereVolume)[iElem] = 0.0;
-      (*epetraSphereNodeId)[iElem] = -2;
+  Epetra_Vector epetraSphereCoords(epetraThreeDimensionalMap);
+  Epetra_Vector epetraSphereVolume(epetraOneDimensionalMap);
+  Epetra_Vector epetraSphereNodeId(epetraOneDimensionalMap);
+  for(unsigned int i=0 ; i<sphereGlobalElemIds.size() ; ++i){
+    for(int dof=0 ; dof<3 ; dof++){
+      epetraSphereCoords[3*i+dof] = sphereCoords[3*i+dof];
     }
+    epetraSphereVolume[i] = sphereVolumes[i];
+    epetraSphereNodeId[i] = static_cast<double>( sphereNodeIds[i] );
   }
 
-  // Bring all necessary off-processor data onto this processor
+  // Bring the data of the off-processor candidates onto this processor
   Epetra_Vector epetraOverlapCoords(epetraThreeDimensionalOverlapMap);
-  Epetra_Vector epetraOverlapSphereVolume(*epetraOneDimensionalOverlapMap);
-  Epetra_Vector epetraOverlapSphereNodeId(*epetraOneDimensionalOverlapMap);
+  Epetra_Vector epetraOverlapSphereVolume(epetraOneDimensionalOverlapMap);
+  Epetra_Vector epetraOverlapSphereNodeId(epetraOneDimensionalOverlapMap);
   Epetra_Import threeDimensionalImporter(epetraThreeDimensionalOverlapMap, epetraThreeDimensionalMap);
-  Epetra_Import oneDimensionalImporter(*epetraOneDimensionalOverlapMap, epetraOneDimensionalMap);
-  int coordsImportErrorCode = epetraOverlapCoords.Import(*epetraProximitySearchCoords, threeDimensionalImporter, Insert);
-  int volumeImportErrorCode = epetraOverlapSphereVolume.Import(*epetraSphereVolume, oneDimensionalImporter, Insert);
-  int sphereNodeIdImportErrorCode = epetraOverlapSphereNodeId.Import(*epetraSphereNodeId, oneDimensionalImporter, Insert);
+  Epetra_Import oneDimensionalImporter(epetraOneDimensionalOverlapMap, epetraOneDimensionalMap);
+  int coordsImportErrorCode = epetraOverlapCoords.Import(epetraSphereCoords, threeDimensionalImporter, Insert);
+  int volumeImportErrorCode = epetraOverlapSphereVolume.Import(epetraSphereVolume, oneDimensionalImporter, Insert);
+  int sphereNodeIdImportErrorCode = epetraOverlapSphereNodeId.Import(epetraSphereNodeId, oneDimensionalImporter, Insert);
   TEUCHOS_TEST_FOR_EXCEPT_MSG(coordsImportErrorCode != 0 || volumeImportErrorCode != 0 || sphereNodeIdImportErrorCode != 0,
 			      "\n\n**** Error in PeridigmManager::obcOverlappingElementSearch(), import operation failed!\n\n");
 
@@ -679,18 +666,20 @@ void LCM::PeridigmManager::obcOverlappingElementSearch()
   }
 
   // All sphere elements that could possibly be within an on-processor solid element are now available
-  // on processor.  Some other points have been ghosted as well (barycenters of solid elements); they
-  // will be ignored as we check for peridynamic nodes within each on-processor solid element.
-
-  // Loop over all the on-processor nodes and check to see if any of the peridynamic nodes identified
-  // by the proximity search are within the element
-  int neighborhoodListIndex = 0;
+  // on processor.  Check which of the candidates of each solid element are actually inside it.
   typedef PHX::KokkosViewFactory<RealType, PHX::Device> ViewFactory;
 
   for(unsigned int iElem=0 ; iElem<elements.size() ; ++iElem){
 
-    // Get the elements nodes and cell topology
+    // Skip peridynamic nodes and solid elements without candidates
     int numNodesInElement = bulkData->num_nodes(elements[iElem]);
+    std::map< stk::mesh::EntityId, std::vector<int> >::const_iterator candidates =
+      candidateSphereElemIds.find(bulkData->identifier(elements[iElem]));
+    if(numNodesInElement == 1 || candidates == candidateSphereElemIds.end()){
+      continue;
+    }
+
+    // Get the elements nodes and cell topology
     const stk::mesh::Entity* nodesInElement = bulkData->begin_nodes(elements[iElem]);
     int globalElementId = bulkData->identifier(elements[iElem]) - 1;
     std::map<int, CellTopologyData>::iterator it = albanyGlobalElementIdToCellTopolotyData.find(globalElementId);
@@ -698,80 +687,66 @@ void LCM::PeridigmManager::obcOverlappingElementSearch()
     const CellTopologyData& cellTopologyData = it->second;
     shards::CellTopology cellTopology(&cellTopologyData);
 
-    // The neighbors are the nodes that might be within the element
-    int numNeighbors = neighborList[neighborhoodListIndex++];
+    for(unsigned int iNeighbor=0 ; iNeighbor<candidates->second.size() ; iNeighbor++){
 
-    // Skip peridynamic nodes
-    if(numNodesInElement == 1){
-      neighborhoodListIndex += numNeighbors;
-    }
-    else{
+      int neighborIndex = epetraOneDimensionalOverlapMap.LID(candidates->second[iNeighbor]);
+      int neighborSphereNodeId = static_cast<int>( epetraOverlapSphereNodeId[neighborIndex] );
+      double neighborSphereVolume = epetraOverlapSphereVolume[neighborIndex];
 
-      for(int iNeighbor=0 ; iNeighbor<numNeighbors ; iNeighbor++){
-
-	int neighborIndex = neighborList[neighborhoodListIndex++];
-	int neighborSphereNodeId = static_cast<int>( epetraOverlapSphereNodeId[neighborIndex] );
-	double neighborSphereVolume = epetraOverlapSphereVolume[neighborIndex];
-
-	// If the neighbor is a peridynamic sphere element, check to see if it's within the solid element
-	if(neighborSphereNodeId > -1){
-
-	  std::vector<double> neighborCoords(3);
-	  for(int dof=0 ; dof<3 ; dof++){
-	    neighborCoords[dof] = epetraOverlapCoords[3*neighborIndex+dof];
-	  }
-
-	  // We're interested in a single point in a single element in a three-dimensional simulation
- 	  int numCells = 1;
-	  int numQuadPoints = 1;
-	  int numDim = 3;
-
-	  // Physical points, which are the physical (x, y, z) values of the peridynamic node (pay no attention to the "quadrature point" descriptor)
-	  Kokkos::DynRankView<RealType, PHX::Device> physPoints("PPP", numCells, numQuadPoints, numDim);
-
-	  // Reference points, which are the natural coordinates of the quadrature points
-	  Kokkos::DynRankView<RealType, PHX::Device> refPoints("PPP", numCells, numQuadPoints, numDim);
-
-	  // Cell workset, which is the set of nodes for the given element
-	  Kokkos::DynRankView<RealType, PHX::Device> cellWorkset("PPP", numCells, numNodesInElement, numDim);
-
- 	  for(int dof=0 ; dof<3 ; dof++){
- 	    physPoints(0, 0, dof) = neighborCoords[dof];
- 	  }
-
- 	  for(int i=0 ; i<numNodesInElement ; i++){
- 	    double* coordinates = stk::mesh::field_data(*coordinatesField, nodesInElement[i]);
- 	    for(int dof=0 ; dof<3 ; dof++){
- 	      cellWorkset(0, i, dof) = coordinates[dof];
- 	    }
- 	  }
-
-	  Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(refPoints, physPoints, cellWorkset, cellTopology); //, -1); TODO: check this
-
-	  bool refPointsAreNan = !boost::math::isfinite(refPoints(0,0,0)) || !boost::math::isfinite(refPoints(0,0,1)) || !boost::math::isfinite(refPoints(0,0,2));
-	  TEUCHOS_TEST_FOR_EXCEPT_MSG(refPointsAreNan, "\n**** Error in PeridigmManager::obcOverlappingElementSearch(), NaN in refPoints.\n");
-
-	   Kokkos::DynRankView<RealType, PHX::Device> point("point", 3);
-	  for(int dof=0 ; dof<3 ; dof++){
-	    point(dof) = refPoints(0, 0, dof);
-	  }
-          
-	  int inElement = Intrepid2::CellTools<PHX::Device>::checkPointInclusion(point, cellTopology);
-
-	  if(inElement){
-	    OBCDataPoint dataPoint;
-	    dataPoint.sphereElementVolume = neighborSphereVolume;
-	    for(int dof=0 ; dof<3 ; dof++){
-	      dataPoint.initialCoords[dof] = neighborCoords[dof];
-	      dataPoint.currentCoords[dof] = 0.0;
-	      dataPoint.naturalCoords[dof] = point[dof];
-	    }
-	    dataPoint.peridigmGlobalId = neighborSphereNodeId;
-	    dataPoint.albanyElement = elements[iElem];
-	    dataPoint.cellTopologyData = cellTopologyData;
-	    obcDataPoints->push_back(dataPoint);
-	  }
-	}
+      std::vector<double> neighborCoords(3);
+      for(int dof=0 ; dof<3 ; dof++){
+        neighborCoords[dof] = epetraOverlapCoords[3*neighborIndex+dof];
+      }
+
+      // We're interested in a single point in a single element in a three-dimensional simulation
+      int numCells = 1;
+      int numQuadPoints = 1;
+      int numDim = 3;
+
+      // Physical points, which are the physical (x, y, z) values of the peridynamic node (pay no attention to the "quadrature point" descriptor)
+      Kokkos::DynRankView<RealType, PHX::Device> physPoints("PPP", numCells, numQuadPoints, numDim);
+
+      // Reference points, which are the natural coordinates of the quadrature points
+      Kokkos::DynRankView<RealType, PHX::Device> refPoints("PPP", numCells, numQuadPoints, numDim);
+
+      // Cell workset, which is the set of nodes for the given element
+      Kokkos::DynRankView<RealType, PHX::Device> cellWorkset("PPP", numCells, numNodesInElement, numDim);
+
+      for(int dof=0 ; dof<3 ; dof++){
+        physPoints(0, 0, dof) = neighborCoords[dof];
+      }
+
+      for(int i=0 ; i<numNodesInElement ; i++){
+        double* coordinates = stk::mesh::field_data(*coordinatesField, nodesInElement[i]);
+        for(int dof=0 ; dof<3 ; dof++){
+          cellWorkset(0, i, dof) = coordinates[dof];
+        }
+      }
+
+      Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(refPoints, physPoints, cellWorkset, cellTopology); //, -1); TODO: check this
+
+      bool refPointsAreNan = !boost::math::isfinite(refPoints(0,0,0)) || !boost::math::isfinite(refPoints(0,0,1)) || !boost::math::isfinite(refPoints(0,0,2));
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(refPointsAreNan, "\n**** Error in PeridigmManager::obcOverlappingElementSearch(), NaN in refPoints.\n");
+
+      Kokkos::DynRankView<RealType, PHX::Device> point("point", 3);
+      for(int dof=0 ; dof<3 ; dof++){
+        point(dof) = refPoints(0, 0, dof);
+      }
+
+      int inElement = Intrepid2::CellTools<PHX::Device>::checkPointInclusion(point, cellTopology);
+
+      if(inElement){
+        OBCDataPoint dataPoint;
+        dataPoint.sphereElementVolume = neighborSphereVolume;
+        for(int dof=0 ; dof<3 ; dof++){
+          dataPoint.initialCoords[dof] = neighborCoords[dof];
+          dataPoint.currentCoords[dof] = 0.0;
+          dataPoint.naturalCoords[dof] = point[dof];
+        }
+        dataPoint.peridigmGlobalId = neighborSphereNodeId;
+        dataPoint.albanyElement = elements[iElem];
+        dataPoint.cellTopologyData = cellTopologyData;
+        obcDataPoints->push_back(dataPoint);
       }
     }
   }
@@ -73,6 +73,7 @@ public:
 		  const Teuchos::RCP<const Teuchos_Comm>& comm);
 
   //! Identify the overlapping solid element for each peridynamic sphere element (applies only to overlapping discretizations).
+  //! Uses a parallel bounding-box search and may be called again whenever the mesh changes.
   void obcOverlappingElementSearch();
 
   //! Evaluate the functional for optimization-based coupling
@@ -158,6 +159,7 @@ private:
 
   bool enableOptimizationBasedCoupling;
   double obcScaleFactor;
+  double obcSearchTolerance;
 
   double previousTime;
   double currentTime;
@@ -173,12 +173,19 @@ int main(int argc, char *argv[]) {
     }
 
     Albany::SolverFactory slvrfctry(cmd.xml_filename, comm);
+
+    // Per-phase memory accounting, reported with the memory analysis.
+    if (slvrfctry.getParameters().isSublist("Debug Output"))
+      Albany::MemoryTracker::instance().enable(
+          slvrfctry.getParameters().sublist("Debug Output").get<bool>(
+              "Analyze Memory", false));
     RCP<const Epetra_Comm> appComm = Albany::createEpetraCommFromTeuchosComm(comm);
     RCP<Albany::Application> app;
     const RCP<Thyra::ModelEvaluator<double> > solver =
       slvrfctry.createThyraSolverAndGetAlbanyApp(app, comm, comm);
 
     setupTimer.~TimeMonitor();
+    Albany::MemoryTracker::instance().setPhase("Solve");
 
 //    PHX::InitializeKokkosDevice();
    
@@ -281,8 +288,10 @@ int main(int argc, char *argv[]) {
     if (writeToCoutSoln == true) 
        std::cout << "xfinal: " << *xfinal << std::endl;
 
-    if (debugParams.get<bool>("Analyze Memory", false))
+    if (debugParams.get<bool>("Analyze Memory", false)) {
       Albany::printMemoryAnalysis(std::cout, comm);
+      Albany::MemoryTracker::instance().print(std::cout, comm);
+    }
 
     if (writeToMatrixMarketSoln == true) { 
 
@@ -309,11 +309,19 @@ main(int argc, char *argv[]) {
     if (cmd.vtune) { Albany::connect_vtune(comm->getRank()); }
 
     Albany::SolverFactory slvrfctry(cmd.xml_filename, comm);
+
+    // Per-phase memory accounting, reported with the memory analysis.
+    if (slvrfctry.getParameters().isSublist("Debug Output"))
+      Albany::MemoryTracker::instance().enable(
+          slvrfctry.getParameters().sublist("Debug Output").get<bool>(
+              "Analyze Memory", false));
+
     RCP<Albany::Application> app;
     const RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solver =
         slvrfctry.createAndGetAlbanyAppT(app, comm, comm);
 
     setupTimer.~TimeMonitor();
+    Albany::MemoryTracker::instance().setPhase("Solve");
 
     std::string solnMethod =
         slvrfctry.getParameters().sublist("Problem").get<std::string>(
@@ -538,8 +546,10 @@ main(int argc, char *argv[]) {
         Albany::printTpetraVector(*out << "\nxfinal:\n", xfinal);
       }
 
-      if (debugParams.get<bool>("Analyze Memory", false))
+      if (debugParams.get<bool>("Analyze Memory", false)) {
         Albany::printMemoryAnalysis(std::cout, comm);
+        Albany::MemoryTracker::instance().print(std::cout, comm);
+      }
 
       if (writeToMatrixMarketSoln == true) {
         // create serial map that puts the whole solution on processor 0
@@ -266,6 +266,18 @@ void broadcast (const Teuchos_Comm& comm, const int root_rank,
 # endif //ALBANY_ENSEMBLE
 #endif //ALBANY_SG
 
+void setDirichletRowT(
+  Tpetra_CrsMatrix& jacT, const LO row, const ST diag,
+  Teuchos::Array<ST>& entries)
+{
+  Teuchos::ArrayView<const LO> indices;
+  jacT.getCrsGraph()->getLocalRowView(row, indices);
+  entries.resize(indices.size());
+  for (int k = 0; k < indices.size(); ++k)
+    entries[k] = (indices[k] == row) ? diag : 0.0;
+  jacT.replaceLocalValues(row, indices, entries());
+}
+
 #define eti(T)                                                          \
   template void reduceAll<T> (                                          \
     const Teuchos_Comm&, const Teuchos::EReductionType, PHX::MDField<T>&);
@@ -89,6 +89,13 @@ template<typename T>
 void broadcast(
   const Teuchos_Comm& comm, const int root_rank, PHX::MDField<T>& a);
 
+//! Replace row \c row of \c jacT by \c diag on the diagonal and zeros
+//! elsewhere, in one call. The column indices are viewed in the matrix graph,
+//! nothing is copied out of the matrix; \c entries is scratch space.
+void setDirichletRowT(
+  Tpetra_CrsMatrix& jacT, const LO row, const ST diag,
+  Teuchos::Array<ST>& entries);
+
 /*! \brief Loop over an array and apply a functor.
  *
  * The functor has the form
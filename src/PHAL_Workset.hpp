@@ -49,6 +49,25 @@ class Application;
 
 namespace PHAL {
 
+//! Set of local DOF ids stored as a bitmask, so that the DOFs already set
+//! by Dirichlet BCs can be looked up in constant time.
+class DofMask {
+public:
+  void insert(LO const dof)
+  {
+    if (dof >= static_cast<LO>(mask_.size())) mask_.resize(dof + 1, false);
+    mask_[dof] = true;
+  }
+
+  bool contains(LO const dof) const
+  {
+    return dof < static_cast<LO>(mask_.size()) && mask_[dof];
+  }
+
+private:
+  std::vector<bool> mask_;
+};
+
 struct Workset {
 
   Workset() :
@@ -109,6 +128,9 @@ struct Workset {
 #endif
   //Tpetra analog of Jac
   Teuchos::RCP<Tpetra_CrsMatrix> JacT;
+  //Rows of JacT (and fT) that the Dirichlet field manager replaces after
+  //the fill; ScatterResidual does not assemble them. Null if none.
+  Teuchos::RCP<const DofMask> dirichletRows;
 
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Epetra_MultiVector> JV;
@@ -190,7 +212,7 @@ struct Workset {
   Teuchos::RCP<Albany::Application>
   current_app_;
 
-  std::set<int>
+  DofMask
   fixed_dofs_;
 #endif
 
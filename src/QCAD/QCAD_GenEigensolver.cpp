@@ -11,6 +11,9 @@
 //#include "Sacado_PCE_OrthogPoly.hpp"
 
 
+#include <algorithm>
+#include <cmath>
+
 #include "Teuchos_XMLParameterListHelpers.hpp"
 #include "Teuchos_TestForException.hpp"
 
@@ -32,6 +35,37 @@
 #include "AnasaziBasicOutputManager.hpp"
 #include "AnasaziEpetraAdapter.hpp"
 #include "Epetra_CrsMatrix.h"
+#include "Epetra_InvOperator.h"
+#include "Ifpack.h"
+
+namespace {
+
+// Max-norm of (A - B) relative to the max-norm of B, for two matrices with
+// the same graph (e.g. two Jacobians of the same model).  Returns a large
+// value if the graphs differ.
+double relativeChange(const Epetra_CrsMatrix& A, const Epetra_CrsMatrix& B)
+{
+  double local[2] = {0.0, 0.0}, global[2];
+  bool sameGraph = (A.NumMyRows() == B.NumMyRows());
+  for(int i=0; sameGraph && i<A.NumMyRows(); i++) {
+    int nA, nB;
+    double *vA, *vB;
+    int *cA, *cB;
+    A.ExtractMyRowView(i, nA, vA, cA);
+    B.ExtractMyRowView(i, nB, vB, cB);
+    if(nA != nB) { sameGraph = false; break; }
+    for(int j=0; j<nA; j++) {
+      if(cA[j] != cB[j]) { sameGraph = false; break; }
+      local[0] = std::max(local[0], std::fabs(vA[j]-vB[j]));
+      local[1] = std::max(local[1], std::fabs(vB[j]));
+    }
+  }
+  if(!sameGraph) local[0] = 1e100;
+  A.Comm().MaxAll(local, global, 2);
+  return (global[1] > 0) ? global[0] / global[1] : global[0];
+}
+
+}
 
 
 
@@ -61,6 +95,18 @@ GenEigensolver(const Teuchos::RCP<Teuchos::ParameterList>& eigensolveParams,
   maxIters = myParams->get<int>("Maximum Iterations",500);
   conv_tol = myParams->get<double>("Convergece Tolerance",1.0e-8);
 
+  // Options for repeated eigensolves of slowly changing operators, as in a
+  //  self-consistent Poisson-Schrodinger loop
+  bRecycleEvecs = myParams->get<bool>("Recycle Eigenvectors",true);
+  precType = myParams->get<std::string>("Preconditioner Type","None");
+  precOverlap = myParams->get<int>("Preconditioner Overlap",0);
+  precParams = myParams->sublist("Ifpack Settings");
+  precReuseTol = myParams->get<double>("Preconditioner Reuse Tolerance",0.1);
+  bAdaptiveTol = myParams->get<bool>("Adaptive Tolerance",false);
+  adaptiveTolFactor = myParams->get<double>("Adaptive Tolerance Factor",0.1);
+  maxConvTol = myParams->get<double>("Maximum Convergence Tolerance",1.0e-4);
+  outerResidual = -1.0;
+
   myComm = comm;
 }
 
@@ -185,6 +231,33 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   Teuchos::RCP<Epetra_MultiVector> ivec = Teuchos::rcp( new Epetra_MultiVector(K->OperatorDomainMap(), blockSize) );
   ivec->Random();
 
+  // Start from the eigenvectors of the previous solve, which are close to the
+  //  current ones when the operator changes little between calls
+  if(bRecycleEvecs && prevEvecs != Teuchos::null && prevEvecs->Map().SameAs(ivec->Map())) {
+    for(int i=0; i<std::min(blockSize, prevEvecs->NumVectors()); i++)
+      *((*ivec)(i)) = *((*prevEvecs)(i));
+  }
+
+  // (Re)compute the preconditioner only if K has changed enough since it was last built
+  if(precType != "None") {
+    if(prec == Teuchos::null || relativeChange(*K, *precMatrix) > precReuseTol) {
+      Ifpack factory;
+      prec = Teuchos::rcp( factory.Create(precType, K.get(), precOverlap) );
+      TEUCHOS_TEST_FOR_EXCEPTION(prec == Teuchos::null, Teuchos::Exceptions::InvalidParameter,
+         "Unknown eigensolver preconditioner type: " << precType << std::endl);
+      Teuchos::ParameterList ifpackParams(precParams);
+      prec->SetParameters(ifpackParams);
+      prec->Initialize();
+      prec->Compute();
+      precMatrix = K;
+    }
+  }
+
+  // Loosen the tolerance while the enclosing iteration is far from converged
+  double tol = conv_tol;
+  if(bAdaptiveTol && outerResidual > 0)
+    tol = std::max(conv_tol, std::min(maxConvTol, adaptiveTolFactor*outerResidual));
+
   // Create the eigenproblem.
   Teuchos::RCP<Anasazi::BasicEigenproblem<double, MV, OP> > eigenProblem =
     Teuchos::rcp( new Anasazi::BasicEigenproblem<double, MV, OP>(K, M, ivec) );
@@ -192,6 +265,9 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   // Inform the eigenproblem that the operator A is symmetric
   eigenProblem->setHermitian(bHermitian);
 
+  if(prec != Teuchos::null)
+    eigenProblem->setPrec( Teuchos::rcp( new Epetra_InvOperator(prec.get()) ) );
+
   // Set the number of eigenvalues requested
   eigenProblem->setNEV( nev );
 
@@ -206,7 +282,7 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   eigenPL.set( "Which", which );
   eigenPL.set( "Block Size", blockSize );
   eigenPL.set( "Maximum Iterations", maxIters );
-  eigenPL.set( "Convergence Tolerance", conv_tol );
+  eigenPL.set( "Convergence Tolerance", tol );
   eigenPL.set( "Full Ortho", true );
   eigenPL.set( "Use Locking", true );
   eigenPL.set( "Verbosity", Anasazi::IterationDetails );
@@ -222,6 +298,8 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   std::vector<Anasazi::Value<double> > evals = sol.Evals;
   Teuchos::RCP<MV> evecs = sol.Evecs;
 
+  if(bRecycleEvecs && sol.numVecs > 0) prevEvecs = Teuchos::rcp( new Epetra_MultiVector(*evecs) );
+
   std::vector<double> evals_real(sol.numVecs);
   for(int i=0; i<sol.numVecs; i++) evals_real[i] = evals[i].realpart;
 
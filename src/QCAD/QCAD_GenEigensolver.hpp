@@ -13,6 +13,8 @@
 //#include "LOCA_Epetra.H"
 #include "Epetra_Map.h"
 #include "Epetra_Vector.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_CrsMatrix.h"
 //#include "Epetra_LocalMap.h"
 #include "EpetraExt_ModelEvaluator.h"
 #include "Teuchos_RCP.hpp"
@@ -20,6 +22,8 @@
 
 #include "Albany_StateManager.hpp"
 
+class Ifpack_Preconditioner;
+
 //#include "LOCA_Epetra_ModelEvaluatorInterface.H"
 //#include <NOX_Epetra_MultiVector.H>
 
@@ -62,6 +66,10 @@ namespace QCAD {
 
     void evalModel( const InArgs& inArgs, const OutArgs& outArgs ) const;    
 
+    //! Set the residual of an enclosing (e.g. Poisson-Schrodinger) iteration,
+    //!  used to loosen the eigensolver tolerance while it is large
+    void setOuterResidual(double resid) { outerResidual = resid; }
+
   private:
     Teuchos::RCP<EpetraExt::ModelEvaluator> model;
     Teuchos::RCP<Albany::StateManager> observer; //use a state manager as an observer (holds eigen data)
@@ -74,6 +82,18 @@ namespace QCAD {
     std::string which;
     int nev, blockSize, maxIters;
     double conv_tol;
+
+    //Recycling between successive eigensolves
+    bool bRecycleEvecs, bAdaptiveTol;
+    std::string precType;
+    int precOverlap;
+    Teuchos::ParameterList precParams;
+    double precReuseTol, adaptiveTolFactor, maxConvTol;
+
+    mutable double outerResidual;
+    mutable Teuchos::RCP<Epetra_MultiVector> prevEvecs;
+    mutable Teuchos::RCP<Epetra_CrsMatrix> precMatrix; //matrix the preconditioner was computed from
+    mutable Teuchos::RCP<Ifpack_Preconditioner> prec;
   };
 }
 #endif
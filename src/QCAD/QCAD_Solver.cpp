@@ -6,6 +6,7 @@
 
 #include "QCAD_Solver.hpp"
 #include "QCAD_CoupledPoissonSchrodinger.hpp"
+#include "QCAD_GenEigensolver.hpp"
 #include "Piro_Epetra_LOCASolver.hpp"
 
 #include "Petra_Converters.hpp"
@@ -1893,6 +1894,11 @@ bool QCAD::Solver::doPSLoop(const std::string& mode, const InArgs& inArgs,
       solverComm->SumAll(&local_nEls, &global_nEls, 1);
       global_maxDiff /= global_nEls;
 
+      //Let a LOBPCG Schrodinger solve loosen its tolerance while the P-S loop is far from converged
+      Teuchos::RCP<QCAD::GenEigensolver> schroEigensolver =
+	Teuchos::rcp_dynamic_cast<QCAD::GenEigensolver>(subSolvers["Schrodinger"].model);
+      if(schroEigensolver != Teuchos::null) schroEigensolver->setOuterResidual(global_maxDiff);
+
       //if we don't progress toward convergence
       if(best_global_maxDiff < global_maxDiff && iter > MIN_ITER) {
 	
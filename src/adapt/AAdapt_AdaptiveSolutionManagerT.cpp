@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 #include "AAdapt_AdaptiveSolutionManagerT.hpp"
+#include "Albany_Memory.hpp"
 #if defined(HAVE_STK)
 #include "AAdapt_CopyRemeshT.hpp"
 #if defined(ALBANY_LCM) && defined(ALBANY_BGL)
@@ -260,6 +261,7 @@ bool
 AAdapt::AdaptiveSolutionManagerT::
 adaptProblem()
 {
+  Albany::MemoryPhase memory_phase("Adapt");
 
   Teuchos::RCP<Thyra::ModelEvaluator<double> > model = this->getState()->getModel();
 
@@ -11,12 +11,27 @@
 #include "AAdapt_AnalyticFunction.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_Exceptions.hpp"
+#include "Kokkos_Core.hpp"
 
 #include "Aeras_ShallowWaterConstants.hpp"
 
 const double pi = 3.141592653589793;
 
 
+void AAdapt::AnalyticFunction::computeBatch(const int numPoints, const int neq, const int numDim,
+                                            double* x, const double* X) {
+  if(!isThreadSafe()) {
+    for(int p = 0; p < numPoints; p++)
+      compute(x + p * neq, X + p * numDim);
+    return;
+  }
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, numPoints),
+                       [=](const int p) {
+    this->compute(x + p * neq, X + p * numDim);
+  });
+}
+
 // Factory method to build functions based on a string
 Teuchos::RCP<AAdapt::AnalyticFunction> AAdapt::createAnalyticFunction(
   std::string name, int neq, int numDim,
@@ -1229,7 +1244,7 @@ void AAdapt::AerasXZHydrostaticMountain::compute(double* x, const double* X) {
 
 //*****************************************************************************
 AAdapt::AerasHydrostaticBaroclinicInstabilities::AerasHydrostaticBaroclinicInstabilities(int neq_, int numDim_, Teuchos::Array<double> data_)
-  : numDim(numDim_), neq(neq_), data(data_), printedHybrid(false) {
+  : numDim(numDim_), neq(neq_), data(data_) {
   TEUCHOS_TEST_FOR_EXCEPTION((numDim != 3),
                              std::logic_error,
                              "Error! Invalid call of Aeras Hydrostatic Baroclinic Instabilities Model " << neq
@@ -1238,51 +1253,13 @@ AAdapt::AerasHydrostaticBaroclinicInstabilities::AerasHydrostaticBaroclinicInsta
                              std::logic_error,
                              "Error! Invalid call of Aeras Hydrostatic Baroclinic Instabilities Model: Function Data array must have size 3; " 
                              << "you have provided an array of size " << data.size() << std::endl);
-}
-void AAdapt::AerasHydrostaticBaroclinicInstabilities::compute(double* solution, const double* X) {
 
-  const int numLevels  = (int) data[0];
-  const int numTracers = (int) data[1];
-  const bool perturbation = (bool) data[2]; 
+  // Print the A,B coefficients in homme format once, here rather than in
+  // compute, which may run concurrently on many points.
+  const int numLevels = (int) data[0];
   const double Ptop = 219.4067;
-  const double SP0 =  1e5;     // = p0
-  const double u0  =  35.0;     //
-
-  //From Homme, 26 levels ASP baroclinic TC (see file cami-26.ascii):
-  //A[top] = 0.00219406700000001 = eta_top = p_top/p0,
-  //that is, p_top = A[top]*p0 = 219.4067 .
-
-  const double Eta0 = 0.252, Etas=1.0, Etat=0.2, TT0=288.0,
-		       Gamma = 0.005, deltaT = 4.8E+5, Rd = 287.04;
-  const double radius                 = 10.0;// radius of the perturbation
-  const double perturbation_amplitude =  1.0;// amplitude of u perturbation 1 m/s
-  const double perturbation_longitude = 20.0;// longitudinal position, 20E
-  const double perturbation_latitude  = 40.0;// latitudinal position, 40N
-
-  std::vector<double> q0(numTracers);
-  for (int nt = 0; nt<numTracers; ++nt) {
-    q0[nt] = data[6 + nt];
-  }
-
-  //printf(".....inside Baroclinic Instabilities\n");
-
-  std::vector<double> Pressure(numLevels);
-  std::vector<double> Pi(numLevels);
-  const double P0   = SP0;
-  const double Ps   = P0;
+  const double P0   = 1e5;
   const Aeras::Eta<DoubleType> &EP = Aeras::Eta<DoubleType>::self(Ptop,P0,numLevels);
-
-  //This will be used later for tracers.
-  for (int i=0; i<numLevels; ++i) Pressure[i] = EP.A(i)*EP.p0() + EP.B(i)*Ps;
-  for (int i=0; i<numLevels; ++i) {
-    const double pp   = i<numLevels-1 ? 0.5*(Pressure[i] + Pressure[i+1]) : Ps;
-    const double pm   = i             ? 0.5*(Pressure[i] + Pressure[i-1]) : EP.ptop();
-    Pi[i] = (pp - pm) / EP.delta(i);
-  }
-
-
-  //Uncomment if you want A,B coefficients in homme format.
-  if(!printedHybrid){
   std::cout << "--------------------PRINTING HYBRID COEFS ----------------------\n";
   int prec = 15;
   std::cout << numLevels << "   ! hyam \n";
@@ -1320,9 +1297,48 @@ void AAdapt::AerasHydrostaticBaroclinicInstabilities::compute(double* solution,
   for (int i=0; i<numLevels; ++i) {
       std::cout << std::setprecision(prec) << EP.eta(i) << "\n";
   }
-  printedHybrid = true;
-  }
   ////////////////////// end of printing out coefficients in homme format
+}
+void AAdapt::AerasHydrostaticBaroclinicInstabilities::compute(double* solution, const double* X) {
+
+  const int numLevels  = (int) data[0];
+  const int numTracers = (int) data[1];
+  const bool perturbation = (bool) data[2]; 
+  const double Ptop = 219.4067;
+  const double SP0 =  1e5;     // = p0
+  const double u0  =  35.0;     //
+
+  //From Homme, 26 levels ASP baroclinic TC (see file cami-26.ascii):
+  //A[top] = 0.00219406700000001 = eta_top = p_top/p0,
+  //that is, p_top = A[top]*p0 = 219.4067 .
+
+  const double Eta0 = 0.252, Etas=1.0, Etat=0.2, TT0=288.0,
+		       Gamma = 0.005, deltaT = 4.8E+5, Rd = 287.04;
+  const double radius                 = 10.0;// radius of the perturbation
+  const double perturbation_amplitude =  1.0;// amplitude of u perturbation 1 m/s
+  const double perturbation_longitude = 20.0;// longitudinal position, 20E
+  const double perturbation_latitude  = 40.0;// latitudinal position, 40N
+
+  std::vector<double> q0(numTracers);
+  for (int nt = 0; nt<numTracers; ++nt) {
+    q0[nt] = data[6 + nt];
+  }
+
+  //printf(".....inside Baroclinic Instabilities\n");
+
+  std::vector<double> Pressure(numLevels);
+  std::vector<double> Pi(numLevels);
+  const double P0   = SP0;
+  const double Ps   = P0;
+  const Aeras::Eta<DoubleType> &EP = Aeras::Eta<DoubleType>::self(Ptop,P0,numLevels);
+
+  //This will be used later for tracers.
+  for (int i=0; i<numLevels; ++i) Pressure[i] = EP.A(i)*EP.p0() + EP.B(i)*Ps;
+  for (int i=0; i<numLevels; ++i) {
+    const double pp   = i<numLevels-1 ? 0.5*(Pressure[i] + Pressure[i+1]) : Ps;
+    const double pm   = i             ? 0.5*(Pressure[i] + Pressure[i-1]) : EP.ptop();
+    Pi[i] = (pp - pm) / EP.delta(i);
+  }
 
   const double x = X[0];
   const double y = X[1];
@@ -2367,6 +2383,9 @@ AAdapt::AerasTC4Init::AerasTC4Init(int neq_, int spatialDim_, Teuchos::Array<dou
   su0 = 20.;
   phi0 = 1.0e5;
 
+  alfa = -0.03*(phi0/(2.*Omega*sin(myPi/4.)));
+  sigma = (2.*earthRadius/1.0e6)*(2.*earthRadius/1.0e6);
+
 }
 
 void AAdapt::AerasTC4Init::compute(double* solution, const double* X) {
@@ -2393,9 +2412,6 @@ void AAdapt::AerasTC4Init::compute(double* solution, const double* X) {
   
   double tol = 1.e-10;
   
-  alfa = -0.03*(phi0/(2.*Omega*sin(myPi/4.)));
-  sigma = (2.*a/1.0e6)*(2.*a/1.0e6);
-  
   
   double ai = 1./a;
   double a2i = ai*ai;
@@ -30,6 +30,15 @@ class AnalyticFunction {
   public:
     virtual ~AnalyticFunction() {}
     virtual void compute(double* x, const double* X) = 0;
+
+    // Evaluates the function at numPoints points: x holds neq values and X
+    // numDim coordinates per point. Points are processed in parallel on the
+    // host execution space when the function is thread safe.
+    virtual void computeBatch(const int numPoints, const int neq, const int numDim,
+                              double* x, const double* X);
+
+    // False for functions whose compute keeps state between calls
+    virtual bool isThreadSafe() const { return true; }
 };
 
 // Factory method to build functions based on a string name
@@ -104,6 +113,7 @@ class ConstantFunctionPerturbed : public AnalyticFunction {
     ConstantFunctionPerturbed(int neq_, int numDim_, int worksetID,
                               Teuchos::Array<double> const_data_, Teuchos::Array<double> pert_mag_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -120,6 +130,7 @@ class ConstantFunctionGaussianPerturbed : public AnalyticFunction {
     ConstantFunctionGaussianPerturbed(int neq_, int numDim_, int worksetID,
                                       Teuchos::Array<double> const_data_, Teuchos::Array<double> pert_mag_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -302,7 +313,6 @@ class AerasHydrostaticBaroclinicInstabilities : public AnalyticFunction {
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
     Teuchos::Array<double> data;
-    bool printedHybrid;
 };
 
 class AerasHydrostaticPureAdvection1 : public AnalyticFunction {
@@ -319,6 +329,8 @@ class AerasHydrostatic3dDeformationalFlow : public AnalyticFunction {
   public:
     AerasHydrostatic3dDeformationalFlow(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    // compute prints on every call.
+    bool isThreadSafe() const { return false; }
   private:
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
@@ -369,6 +381,8 @@ class AerasXZHydrostaticCloud : public AnalyticFunction {
   public:
     AerasXZHydrostaticCloud(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    // compute prints on the first call through a static flag.
+    bool isThreadSafe() const { return false; }
   private:
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
@@ -379,6 +393,8 @@ class AerasXZHydrostaticMountain : public AnalyticFunction {
   public:
     AerasXZHydrostaticMountain(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    // compute prints on every call.
+    bool isThreadSafe() const { return false; }
   private:
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
@@ -602,6 +618,7 @@ class ExpressionParser : public AnalyticFunction {
   public:
     ExpressionParser(int neq_, int spatialDim_, std::string expressionX_, std::string expressionY_, std::string expressionZ_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int spatialDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -6,7 +6,12 @@
 
 
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <vector>
 
 #include <Teuchos_CommHelpers.hpp>
 
@@ -40,6 +45,9 @@ getValidInitialConditionParameters(const Teuchos::ArrayRCP<std::string>& wsEBNam
 
   validPL->set<Teuchos::Array<double> >("Perturb IC", defaultData, "");
 
+  validPL->set<std::string>("IC Cache File", "",
+    "Binary file (one per rank) holding the computed initial condition; reused while the mesh and parameters are unchanged");
+
   return validPL;
 }
 
@@ -265,7 +273,46 @@ wsElNodeEqID[ws](el,ln,5) = DOF[1],eq[2] (z eqn)
 }
 #endif
 
-void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
+namespace {
+
+// Evaluates initFunc once per node of the worksets (rather than once per
+// element containing the node), in a single batch
+void computeAtNodesT(AAdapt::AnalyticFunction& initFunc,
+                     const Teuchos::ArrayRCP<ST>& solnT_nonconstView,
+                     const Albany::AbstractDiscretization::Conn& wsElNodeEqID,
+                     const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords,
+                     const int neq, const int numDim)
+{
+  std::vector<bool> visited(solnT_nonconstView.size(), false);
+  std::vector<LO> lids;
+  std::vector<double> X;
+  for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
+    for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
+      for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
+        const LO lid = wsElNodeEqID[ws](el,ln,0);
+        if (visited[lid]) continue;
+        visited[lid] = true;
+        for (int i=0; i<neq; i++) lids.push_back(wsElNodeEqID[ws](el,ln,i));
+        for (int i=0; i<numDim; i++) X.push_back(coords[ws][el][ln][i]);
+  } } }
+
+  std::vector<double> x(lids.size());
+  for (std::size_t k=0; k<lids.size(); k++) x[k] = solnT_nonconstView[lids[k]];
+  initFunc.computeBatch(lids.size()/neq, neq, numDim, x.data(), X.data());
+  for (std::size_t k=0; k<lids.size(); k++) solnT_nonconstView[lids[k]] = x[k];
+}
+
+// FNV-1a
+void hashBytes(std::uint64_t& hash, const void* data, const std::size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i<size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+}
+
+void computeInitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
                        const Albany::AbstractDiscretization::Conn& wsElNodeEqID,
                        const Teuchos::ArrayRCP<std::string>& wsEBNames,
                        const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords,
@@ -420,16 +467,8 @@ void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
 
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc = Teuchos::rcp(new AAdapt::ExpressionParser(neq, numDim, expressionX, expressionY, expressionZ));
 
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) x[i] = solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)];
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)] = x[i];
-    } } }
+    // Compute soln as a function of coord at all local nodes
+    computeAtNodesT(*initFunc, solnT_nonconstView, wsElNodeEqID, coords, neq, numDim);
 
   }
 
@@ -442,18 +481,88 @@ void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc
       = createAnalyticFunction(name, neq, numDim, data);
   
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) x[i] = solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)];
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)] = x[i];
-    } } }
+    // Compute soln as a function of coord at all local nodes
+    computeAtNodesT(*initFunc, solnT_nonconstView, wsElNodeEqID, coords, neq, numDim);
+
+  }
+
+}
+
+} // namespace
 
+void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
+                       const Albany::AbstractDiscretization::Conn& wsElNodeEqID,
+                       const Teuchos::ArrayRCP<std::string>& wsEBNames,
+                       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords,
+                       const int neq, const int numDim,
+                       Teuchos::ParameterList& icParams, const bool hasRestartSolution)
+{
+  const std::string cacheFile = icParams.get<std::string>("IC Cache File", "");
+  if (cacheFile.empty()) {
+    computeInitialConditionsT(solnT, wsElNodeEqID, wsEBNames, coords, neq, numDim,
+                              icParams, hasRestartSolution);
+    return;
   }
 
+  // The computation is local to each rank, and so is the cache
+  Teuchos::RCP<const Teuchos_Comm> commT = solnT->getMap()->getComm();
+  std::ostringstream fileName;
+  fileName << cacheFile << "." << commT->getSize() << "." << commT->getRank();
+
+  // Key: parameters, the worksets seen by this rank (element block and
+  // size), each of its nodes once (dof ids and coordinates) and the incoming
+  // solution, which some functions read
+  Teuchos::ArrayRCP<ST> solnT_nonconstView = solnT->get1dViewNonConst();
+  // Without the used/default flags, which depend on what read the list before
+  std::ostringstream paramsStr;
+  icParams.print(paramsStr, Teuchos::ParameterList::PrintOptions().showTypes(true).showFlags(false));
+  std::uint64_t key = 14695981039346656037ULL;
+  hashBytes(key, paramsStr.str().data(), paramsStr.str().size());
+  hashBytes(key, &neq, sizeof(neq));
+  hashBytes(key, &numDim, sizeof(numDim));
+  hashBytes(key, &hasRestartSolution, sizeof(hasRestartSolution));
+  std::vector<bool> visited(solnT_nonconstView.size(), false);
+  for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
+    hashBytes(key, wsEBNames[ws].data(), wsEBNames[ws].size());
+    const int dims[2] = {(int) wsElNodeEqID[ws].dimension(0),
+                         (int) wsElNodeEqID[ws].dimension(1)};
+    hashBytes(key, dims, sizeof(dims));
+    for (int el=0; el < dims[0]; el++) {
+      for (int ln=0; ln < dims[1]; ln++) {
+        const LO lid = wsElNodeEqID[ws](el,ln,0);
+        if (visited[lid]) continue;
+        visited[lid] = true;
+        for (int i=0; i<neq; i++) {
+          const LO eqLid = wsElNodeEqID[ws](el,ln,i);
+          hashBytes(key, &eqLid, sizeof(eqLid));
+        }
+        hashBytes(key, coords[ws][el][ln], numDim*sizeof(double));
+  } } }
+  hashBytes(key, solnT_nonconstView.getRawPtr(), solnT_nonconstView.size()*sizeof(ST));
+  const std::int64_t length = solnT_nonconstView.size();
+
+  {
+    std::ifstream in(fileName.str().c_str(), std::ios::binary);
+    std::uint64_t fileKey;
+    std::int64_t fileLength;
+    if (in.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey)) &&
+        in.read(reinterpret_cast<char*>(&fileLength), sizeof(fileLength)) &&
+        fileKey == key && fileLength == length) {
+      std::vector<ST> values(length);
+      if (in.read(reinterpret_cast<char*>(values.data()), length*sizeof(ST))) {
+        std::copy(values.begin(), values.end(), solnT_nonconstView.begin());
+        return;
+      }
+    }
+  }
+
+  computeInitialConditionsT(solnT, wsElNodeEqID, wsEBNames, coords, neq, numDim,
+                            icParams, hasRestartSolution);
+
+  std::ofstream out(fileName.str().c_str(), std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  out.write(reinterpret_cast<const char*>(solnT_nonconstView.getRawPtr()), length*sizeof(ST));
 }
+
 }
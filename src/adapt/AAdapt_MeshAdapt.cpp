@@ -242,10 +242,27 @@ namespace {
   }
 } // end anonymous namespace
 
-void AAdapt::MeshAdapt::afterAdapt()
+void AAdapt::MeshAdapt::afterAdapt(const bool shrunk)
 {
   static int ncalls = 0;
 
+  // Nothing to rebuild if no part changed its mesh. A shrunken partition has
+  // migrated the mesh even if the adapter left it alone, and with the
+  // reference configuration manager the coordinates have been moved, so
+  // rebuild in both cases. The shrink factor is global, so shrunk agrees
+  // on all ranks.
+  int local_changed = szField->meshChanged() ? 1 : 0, changed = 1;
+  Teuchos::reduceAll<int, int>(*Teuchos::DefaultComm<int>::getComm(),
+      Teuchos::REDUCE_MAX, local_changed, Teuchos::outArg(changed));
+  if (changed == 0 && ! shrunk && rc_mgr.is_null()) {
+    *output_stream_ << "Mesh satisfies the size field: "
+                    << "keeping the current discretization" << std::endl;
+    if (should_transfer_ip_data)
+      pumi_discretization->detachQPData();
+    ncalls++;
+    return;
+  }
+
   Teuchos::Array<std::string> defaultStArgs =
      Teuchos::tuple<std::string>("zoltan", "parma", "parma");
   Teuchos::Array<std::string> loadBalancing =
@@ -330,7 +347,7 @@ bool correctnessTestSkip () {
  * If so, it will repartition the mesh onto a subset of the MPI ranks and
  * call (callback), then repartition to the full set of ranks and return.
  */
-void adaptShrunken(apf::Mesh2* m, double min_part_density,
+bool adaptShrunken(apf::Mesh2* m, double min_part_density,
                    Parma_GroupCode& callback);
 
 bool AAdapt::MeshAdapt::adaptMesh()
@@ -347,9 +364,10 @@ bool AAdapt::MeshAdapt::adaptMesh()
     // Old method. No reference configuration updating.
     if ( ! al::correctnessTestSkip()) {
       beforeAdapt();
-      adaptShrunken(pumi_discretization->getPUMIMeshStruct()->getMesh(),
-                    min_part_density, callback);
-      afterAdapt();
+      const bool shrunk = adaptShrunken(
+        pumi_discretization->getPUMIMeshStruct()->getMesh(),
+        min_part_density, callback);
+      afterAdapt(shrunk);
     }
     success = true;
   } else {
@@ -447,9 +465,10 @@ adaptMeshLoop (const double min_part_density, Parma_GroupCode& callback) {
 
     if ( ! al::correctnessTestSkip()) {
       beforeAdapt();
-      adaptShrunken(pumi_discretization->getPUMIMeshStruct()->getMesh(),
-                    min_part_density, callback);
-      afterAdapt();
+      const bool shrunk = adaptShrunken(
+        pumi_discretization->getPUMIMeshStruct()->getMesh(),
+        min_part_density, callback);
+      afterAdapt(shrunk);
     }
 
     // Resize x.
@@ -536,6 +555,8 @@ AAdapt::MeshAdapt::getValidAdapterParameters() const
   validPL->set<bool>("Reference Configuration: Update", false, "Activate RCU");
   validPL->set<bool>("Reference Configuration: Project", false, "???");
   validPL->set<bool>("Reference Configuration: Transform", false, "???");
+  validPL->set<std::string>("Reference Configuration: Projection Method", "Consistent",
+      "Consistent (global mass matrix solve) or Lumped (HRZ lumping per element, no solve)");
 
   /* LOCA options */
   validPL->set<bool>("Equilibrate", true);
@@ -574,16 +595,18 @@ static void warnAboutShrinking(int factor)
         nprocs);
 }
 
-void adaptShrunken(apf::Mesh2* m, double minPartDensity,
+// Returns true if the mesh was migrated onto a subset of the ranks and back.
+bool adaptShrunken(apf::Mesh2* m, double minPartDensity,
                    Parma_GroupCode& callback)
 {
   int factor = getShrinkFactor(m, minPartDensity);
   if (factor == 1) {
     callback.run(0);
-  } else {
-    warnAboutShrinking(factor);
-    Parma_ShrinkPartition(m, factor, callback);
+    return false;
   }
+  warnAboutShrinking(factor);
+  Parma_ShrinkPartition(m, factor, callback);
+  return true;
 }
 
 // Adaptation loop. Looping is necessary only if updating the coordinates leads
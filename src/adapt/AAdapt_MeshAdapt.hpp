@@ -80,7 +80,7 @@ private:
   bool adaptMeshWithRc(const double min_part_density,
                        Parma_GroupCode& callback);
   bool adaptMeshLoop(const double min_part_density, Parma_GroupCode& callback);
-  void afterAdapt();
+  void afterAdapt(const bool shrunk);
 };
 
 } //namespace AAdapt
@@ -30,6 +30,13 @@ struct MeshAdaptMethod {
   virtual void postProcessShrunkenMesh() = 0;
   virtual void postProcessFinalMesh() = 0;
 
+  /*! \brief False if the last adaptMesh left the mesh on this part untouched.
+   *
+   *  Lets MeshAdapt skip rebuilding the discretization when no rank changed
+   *  its mesh. Methods that cannot tell always report a change.
+   */
+  virtual bool meshChanged() const { return true; }
+
 protected:
 
   Teuchos::RCP<Albany::APFDiscretization> apf_disc;
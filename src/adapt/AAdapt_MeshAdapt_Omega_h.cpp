@@ -10,6 +10,7 @@
 #include "AAdapt_ConstantSizeField.hpp"
 
 #include <apfOmega_h.h>
+#include <PCU.h>
 
 #include <Omega_h_teuchos.hpp>
 
@@ -19,7 +20,9 @@ Omega_h_Method::Omega_h_Method(const Teuchos::RCP<Albany::APFDiscretization>& di
   MeshAdaptMethod(disc),
   library_osh(nullptr, nullptr),
   mesh_osh(&library_osh),
-  adapt_opts(disc->getNumDim()) {
+  adapt_opts(disc->getNumDim()),
+  changed(false),
+  unchanged_signature(0) {
   mesh_apf = mesh_struct->getMesh();
 }
 
@@ -31,24 +34,81 @@ void Omega_h_Method::setParams(const Teuchos::RCP<Teuchos::ParameterList>& p) {
   Omega_h::update_adapt_opts(&adapt_opts, omega_h_pl);
   auto& metric_pl = omega_h_pl.sublist("Metric");
   Omega_h::update_metric_input(&metric_opts, metric_pl);
+  unchanged_signature = 0;
 }
 
 void Omega_h_Method::preProcessOriginalMesh() {
+  // Parts left empty by adaptShrunken never call adaptMesh.
+  changed = false;
 }
 
 void Omega_h_Method::preProcessShrunkenMesh() {
 }
 
+// True if the target metric depends only on the mesh, so that adapting an
+// identical mesh again gives an identical result.
+bool Omega_h_Method::metricFromMeshOnly() const {
+  for (std::size_t i = 0; i < metric_opts.sources.size(); ++i) {
+    const Omega_h_Source type = metric_opts.sources[i].type;
+    if (type != OMEGA_H_CONSTANT && type != OMEGA_H_IMPLIED) return false;
+  }
+  return true;
+}
+
+// FNV-1a hash of the part layout, entity counts and vertex coordinates.
+unsigned long long Omega_h_Method::computeSignature() const {
+  unsigned long long h = 14695981039346656037ULL;
+  const auto mix = [&h] (const void* data, const std::size_t n) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < n; ++i) {
+      h ^= p[i];
+      h *= 1099511628211ULL;
+    }
+  };
+  const int layout[2] = {PCU_Comm_Peers(), PCU_Comm_Self()};
+  mix(layout, sizeof(layout));
+  for (int d = 0; d <= mesh_apf->getDimension(); ++d) {
+    const std::size_t n = mesh_apf->count(d);
+    mix(&n, sizeof(n));
+  }
+  apf::MeshIterator* it = mesh_apf->begin(0);
+  apf::MeshEntity* v;
+  apf::Vector3 x;
+  while ((v = mesh_apf->iterate(it))) {
+    mesh_apf->getPoint(v, 0, x);
+    mix(&x[0], 3*sizeof(double));
+  }
+  mesh_apf->end(it);
+  return h == 0 ? 1 : h;
+}
+
 void Omega_h_Method::adaptMesh(const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_) {
+  // If the last adapt left this very mesh alone and the metric comes from the
+  // mesh alone, it will do so again: skip the conversion to Omega_h. The
+  // decision must agree across the parts, since the conversion is collective.
+  const unsigned long long signature = computeSignature();
+  const int local_same = (metricFromMeshOnly() &&
+                          signature == unchanged_signature) ? 1 : 0;
+  changed = false;
+  if (PCU_Min_Int(local_same) == 1) return;
+
   apf::to_omega_h(&mesh_osh, mesh_apf);
-  apf::clear(mesh_apf);
   mesh_osh.set_parting(OMEGA_H_GHOSTED);
   Omega_h::add_implied_metric_tag(&mesh_osh);
   Omega_h::generate_target_metric_tag(&mesh_osh, metric_opts);
   while (Omega_h::approach_metric(&mesh_osh, adapt_opts)) {
-    Omega_h::adapt(&mesh_osh, adapt_opts);
+    if (Omega_h::adapt(&mesh_osh, adapt_opts)) changed = true;
+  }
+  // If the mesh already satisfies the metric, keep the APF mesh as it is and
+  // skip the conversion back (and, in MeshAdapt, the rebuild of the
+  // discretization).
+  if (changed) {
+    apf::clear(mesh_apf);
+    apf::from_omega_h(mesh_apf, &mesh_osh);
+    unchanged_signature = 0;
+  } else {
+    unchanged_signature = signature;
   }
-  apf::from_omega_h(mesh_apf, &mesh_osh);
   mesh_osh = Omega_h::Mesh(&library_osh);
 }
 
@@ -58,4 +118,8 @@ void Omega_h_Method::postProcessShrunkenMesh() {
 void Omega_h_Method::postProcessFinalMesh() {
 }
 
+bool Omega_h_Method::meshChanged() const {
+  return changed;
+}
+
 }
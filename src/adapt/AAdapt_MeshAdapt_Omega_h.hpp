@@ -16,6 +16,9 @@
 
 namespace AAdapt {
 
+/* Adapts the APF mesh with Omega_h. When Omega_h changes the mesh, it is
+   converted to Omega_h and back and the APFDiscretization is rebuilt, as
+   before; only adapts that leave the mesh alone skip that work. */
 class Omega_h_Method : public MeshAdaptMethod {
   public:
     Omega_h_Method(const Teuchos::RCP<Albany::APFDiscretization>& disc);
@@ -29,6 +32,7 @@ class Omega_h_Method : public MeshAdaptMethod {
     void adaptMesh(const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_);
     void postProcessShrunkenMesh();
     void postProcessFinalMesh();
+    bool meshChanged() const;
 
   private:
     ma::Mesh* mesh_apf;
@@ -36,6 +40,11 @@ class Omega_h_Method : public MeshAdaptMethod {
     Omega_h::Mesh mesh_osh;
     Omega_h::AdaptOpts adapt_opts;
     Omega_h::MetricInput metric_opts;
+    bool changed;
+    // Signature of the APF mesh the last adapt left alone, or 0.
+    unsigned long long unchanged_signature;
+    bool metricFromMeshOnly() const;
+    unsigned long long computeSignature() const;
 };
 
 }
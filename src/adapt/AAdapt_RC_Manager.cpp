@@ -165,13 +165,18 @@ class Projector {
   Teuchos::RCP<Tpetra_CrsMatrix> M_;
   Teuchos::RCP<Tpetra_Export> export_;
   Teuchos::RCP<Tpetra_Operator> P_;
+  // With a lumped mass matrix, the reciprocal of its diagonal. Projection is
+  // then a diagonal scaling, and no linear solve is needed. The element
+  // contributions to the lumped matrix are summed in lumped_ol_.
+  const bool lump_mass_;
+  Teuchos::RCP<Tpetra_Vector> inv_lumped_, lumped_ol_;
   // M_ persists over multiple state field manager evaluations if the mesh is
   // not adapted after every LOCA step. Indicate whether this part of M_ has
   // already been filled.
   std::vector<bool> filled_;
 
 public:
-  Projector () {}
+  Projector (const bool lump_mass = false) : lump_mass_(lump_mass) {}
   void init(const Teuchos::RCP<const Tpetra_Map>& node_map,
             const Teuchos::RCP<const Tpetra_Map>& ol_node_map);
   void fillMassMatrix(const PHAL::Workset& workset, const BasisField& bf,
@@ -201,6 +206,9 @@ init (const Teuchos::RCP<const Tpetra_Map>& node_map,
     new Tpetra_CrsMatrix(ol_node_map_, ol_node_map_, max_num_entries));
   export_ = Teuchos::null;
   P_ = Teuchos::null;
+  inv_lumped_ = Teuchos::null;
+  lumped_ol_ = lump_mass_ ?
+    Teuchos::rcp(new Tpetra_Vector(ol_node_map_, true)) : Teuchos::null;
   filled_.clear();
 }
 
@@ -226,6 +234,32 @@ fillMassMatrix (const PHAL::Workset& workset, const BasisField& bf,
       }
       M_->insertGlobalValues(row, cols, vals);
     }
+
+  if ( ! lump_mass_) return;
+  // HRZ lumping, element by element: the diagonal of the element mass matrix
+  // scaled to preserve the element's mass. Row sums are not used, as they
+  // vanish or are negative at the vertices of quadratic elements (e.g.,
+  // Tet10).
+  std::vector<ST> diag(num_node);
+  for (unsigned int cell = 0; cell < workset.numCells; ++cell) {
+    ST diag_mass = 0, mass = 0;
+    for (size_type node = 0; node < num_node; ++node) {
+      diag[node] = 0;
+      for (size_type qp = 0; qp < num_qp; ++qp) {
+        diag[node] += wbf(cell, node, qp) * bf(cell, node, qp);
+        for (size_type cnode = 0; cnode < num_node; ++cnode)
+          mass += wbf(cell, node, qp) * bf(cell, cnode, qp);
+      }
+      diag_mass += diag[node];
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      diag_mass <= 0, std::logic_error,
+      "Lumped projection: an element mass matrix diagonal sums to "
+      << diag_mass);
+    for (size_type node = 0; node < num_node; ++node)
+      lumped_ol_->sumIntoGlobalValue(workset.wsElNodeID[cell][node],
+                                     diag[node] * mass / diag_mass);
+  }
 }
 
 void Projector::
@@ -296,6 +330,22 @@ void Projector::project (Manager::Field& f) {
     M->fillComplete();
     M_ = M;
   }
+  if (lump_mass_ && inv_lumped_.is_null()) {
+    Tpetra_Vector d(M_->getRangeMap(), true);
+    d.doExport(*lumped_ol_, *export_, Tpetra::ADD);
+    int nonpositive = 0, gnonpositive;
+    Teuchos::ArrayRCP<const ST> dv = d.get1dView();
+    for (int i = 0; i < dv.size(); ++i)
+      if ( ! (dv[i] > 0)) ++nonpositive;
+    Teuchos::reduceAll(*M_->getComm(), Teuchos::REDUCE_SUM, 1, &nonpositive,
+                       &gnonpositive);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      gnonpositive > 0, std::logic_error,
+      "Lumped projection: " << gnonpositive << " lumped mass entries are not"
+      " positive; use the consistent projection.");
+    inv_lumped_ = Teuchos::rcp(new Tpetra_Vector(M_->getRangeMap()));
+    inv_lumped_->reciprocal(d);
+  }
   Teuchos::RCP<Tpetra_MultiVector> x[2];
   for (int fi = 0; fi < f.num_g_fields; ++fi) {
     const int nrhs = f.data_->mv[fi]->getNumVectors();
@@ -303,16 +353,21 @@ void Projector::project (Manager::Field& f) {
     Teuchos::RCP<Tpetra_MultiVector>
       b = Teuchos::rcp(new Tpetra_MultiVector(M_->getRangeMap(), nrhs, true));
     b->doExport(*f.data_->mv[fi], *export_, Tpetra::ADD);
-    // Create x[fi] in M_ x[fi] = b[fi]. As a side effect, initialize P_ if
-    // necessary.
-    Teuchos::ParameterList pl;
-    pl.set("Block Size", 1); // Could be nrhs.
-    pl.set("Maximum Iterations", 1000);
-    pl.set("Convergence Tolerance", 1e-12);
-    pl.set("Output Frequency", 10);
-    pl.set("Output Style", 1);
-    pl.set("Verbosity", 0);//33);
-    x[fi] = solve(M_, P_, b, pl); // in AAdapt_RC_Projector_impl
+    if (lump_mass_) {
+      x[fi] = Teuchos::rcp(new Tpetra_MultiVector(M_->getDomainMap(), nrhs));
+      x[fi]->elementWiseMultiply(1, *inv_lumped_, *b, 0);
+    } else {
+      // Create x[fi] in M_ x[fi] = b[fi]. As a side effect, initialize P_ if
+      // necessary.
+      Teuchos::ParameterList pl;
+      pl.set("Block Size", 1); // Could be nrhs.
+      pl.set("Maximum Iterations", 1000);
+      pl.set("Convergence Tolerance", 1e-12);
+      pl.set("Output Frequency", 10);
+      pl.set("Output Style", 1);
+      pl.set("Verbosity", 0);//33);
+      x[fi] = solve(M_, P_, b, pl); // in AAdapt_RC_Projector_impl
+    }
     // Import (reverse mode) to the overlapping MV.
     f.data_->mv[fi]->putScalar(0);
     f.data_->mv[fi]->doImport(*x[fi], *export_, Tpetra::ADD);
@@ -424,9 +479,10 @@ private:
 
 public:
   Impl (const Teuchos::RCP<Albany::StateManager>& state_mgr,
-        const bool use_projection, const bool do_transform)
+        const bool use_projection, const bool do_transform,
+        const bool lump_mass)
     : state_mgr_(state_mgr)
-  { init(use_projection, do_transform); }
+  { init(use_projection, do_transform, lump_mass); }
   
   void registerField (
     const std::string& name, const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -590,11 +646,12 @@ public:
   int numWorksets () const { return is_g_.size(); }
 
 private:
-  void init (const bool use_projection, const bool do_transform) {
+  void init (const bool use_projection, const bool do_transform,
+             const bool lump_mass) {
     transform_ = do_transform;
     building_sfm_ = false;
     if (use_projection) {
-      proj_ = Teuchos::rcp(new Projector());
+      proj_ = Teuchos::rcp(new Projector(lump_mass));
 #ifdef amb_test_projector
       if (proj_tester_.is_null())
         proj_tester_ = Teuchos::rcp(new testing::ProjectorTester());
@@ -655,8 +712,17 @@ create (const Teuchos::RCP<Albany::StateManager>& state_mgr,
           "Reference Configuration: Project", false);
       const bool do_transform = adapt_params.get<bool>(
           "Reference Configuration: Transform", false);
+      const std::string projection_method = adapt_params.get<std::string>(
+          "Reference Configuration: Projection Method", "Consistent");
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        projection_method != "Consistent" && projection_method != "Lumped",
+        std::logic_error,
+        "Unknown Reference Configuration: Projection Method "
+        << projection_method << "; choose Consistent or Lumped.\n");
+      const bool lump_mass = projection_method == "Lumped";
       return 
-		Teuchos::rcp(new Manager(state_mgr, use_projection, do_transform));
+		Teuchos::rcp(new Manager(state_mgr, use_projection, do_transform,
+                                 lump_mass));
     }
 
   }
@@ -816,8 +882,10 @@ bool Manager::usingProjection () const
 { return Teuchos::nonnull(impl_->proj_); }
 
 Manager::Manager (const Teuchos::RCP<Albany::StateManager>& state_mgr,
-                  const bool use_projection, const bool do_transform)
-  : impl_(Teuchos::rcp(new Impl(state_mgr, use_projection, do_transform)))
+                  const bool use_projection, const bool do_transform,
+                  const bool lump_mass)
+  : impl_(Teuchos::rcp(new Impl(state_mgr, use_projection, do_transform,
+                                lump_mass)))
 {}
 
 #define eti_fn(EvalT)                                   \
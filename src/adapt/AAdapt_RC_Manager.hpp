@@ -173,7 +173,8 @@ private:
   Teuchos::RCP<Impl> impl_;
 
   Manager(const Teuchos::RCP<Albany::StateManager>& state_mgr,
-          const bool use_projection, const bool do_transform);
+          const bool use_projection, const bool do_transform,
+          const bool lump_mass);
 };
 
 } // namespace rc
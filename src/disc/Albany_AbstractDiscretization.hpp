@@ -112,6 +112,9 @@ class AbstractDiscretization {
     virtual const NodeSetGIDsList& getNodeSetGIDs() const = 0;
     virtual const NodeSetCoordList& getNodeSetCoords() const = 0;
 
+    //! Get the sorted local DOF ids of equation offset on node set name
+    virtual const std::vector<LO>& getNodeSetDofs(const std::string& name, const int offset) const = 0;
+
     //! Get Side set lists
     virtual const SideSetList& getSideSets(const int ws) const = 0;
 
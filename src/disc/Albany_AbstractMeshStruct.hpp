@@ -8,6 +8,8 @@
 #ifndef ALBANY_ABSTRACTMESHSTRUCT_HPP
 #define ALBANY_ABSTRACTMESHSTRUCT_HPP
 
+#include <map>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Albany_StateInfoStruct.hpp"
 #include "Albany_AbstractFieldContainer.hpp"
@@ -64,6 +66,22 @@ struct LayeredMeshNumbering {
       column_id = id%stride;
     }
   }
+
+  //! Number the columns of the nodes with the given ids contiguously, in
+  //! order of first appearance. Fills the local column and the level of
+  //! each node, and returns the number of columns.
+  T getLocalColumns(const Teuchos::ArrayView<const T>& ids,
+                    const Teuchos::ArrayView<T>& local_column_ids,
+                    const Teuchos::ArrayView<T>& level_indices) const {
+    std::map<T,T> columns;
+    for (int i = 0; i < ids.size(); ++i) {
+      T column_id;
+      getIndices(ids[i], column_id, level_indices[i]);
+      local_column_ids[i] =
+        columns.insert(std::make_pair(column_id, T(columns.size()))).first->second;
+    }
+    return columns.size();
+  }
 };
 
 class CellSpecs {
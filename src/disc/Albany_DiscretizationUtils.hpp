@@ -9,6 +9,8 @@
 #ifndef ALBANY_DISCRETIZATIONUTILS_HPP
 #define ALBANY_DISCRETIZATIONUTILS_HPP
 
+#include <algorithm>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -25,6 +27,37 @@ typedef std::map<std::string, std::vector<std::vector<int> > > NodeSetList;
 typedef std::map<std::string, std::vector<GO> > NodeSetGIDsList;
 typedef std::map<std::string, std::vector<double*> > NodeSetCoordList;
 
+//! Cache of the local DOF ids of one equation over the nodes of a node set,
+//! as flat sorted arrays. A discretization owns one and clears it whenever
+//! its node sets are recomputed, so that Dirichlet BCs do not have to walk
+//! the nested NodeSetList on every evaluation.
+class NodeSetDofs {
+
+  public:
+
+    const std::vector<LO>& get(const NodeSetList& nodeSets,
+                               const std::string& name, const int offset) const {
+      const std::pair<std::string, int> key(name, offset);
+      auto it = dofs.find(key);
+      if (it != dofs.end()) return it->second;
+      std::vector<LO>& d = dofs[key];
+      auto ns = nodeSets.find(name);
+      if (ns != nodeSets.end()) {
+        d.resize(ns->second.size());
+        for (std::size_t i = 0; i < d.size(); ++i) d[i] = ns->second[i][offset];
+        std::sort(d.begin(), d.end());
+      }
+      return d;
+    }
+
+    void clear() { dofs.clear(); }
+
+  private:
+
+    mutable std::map<std::pair<std::string, int>, std::vector<LO> > dofs;
+
+};
+
 class SideStruct {
 
   public:
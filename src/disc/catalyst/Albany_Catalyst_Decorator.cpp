@@ -138,6 +138,12 @@ const NodeSetCoordList &Decorator::getNodeSetCoords() const
   return discretization->getNodeSetCoords();
 }
 
+const std::vector<LO> &Decorator::getNodeSetDofs(const std::string &name,
+                                                 const int offset) const
+{
+  return discretization->getNodeSetDofs(name, offset);
+}
+
 const SideSetList &Decorator::getSideSets(const int workset) const
 {
   return discretization->getSideSets(workset);
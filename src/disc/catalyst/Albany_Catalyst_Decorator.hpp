@@ -85,6 +85,7 @@ public:
   const NodeSetList& getNodeSets() const override;
   const NodeSetGIDsList& getNodeSetGIDs() const override;
   const NodeSetCoordList& getNodeSetCoords() const override;
+  const std::vector<LO>& getNodeSetDofs(const std::string& name, const int offset) const override;
 
   //! Get Side set lists (typedef in Albany_AbstractDiscretization.hpp)
   const SideSetList& getSideSets(const int workset) const override;
@@ -1191,6 +1191,7 @@ void Albany::APFDiscretization::forEachNodeSetNode(
 
 void Albany::APFDiscretization::computeNodeSets()
 {
+  nodeSetDofs.clear();
   // Make sure all the maps are allocated
   for (int i = 0; i < meshStruct->nsNames.size(); i++)
   { // Iterate over Node Sets
@@ -81,6 +81,9 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     //! Get Node set lists (typedef in Albany_AbstractDiscretization.hpp)
     const Albany::NodeSetList& getNodeSets() const { return nodeSets; };
     const Albany::NodeSetCoordList& getNodeSetCoords() const { return nodeSetCoords; };
+    const std::vector<LO>& getNodeSetDofs(const std::string& name, const int offset) const {
+      return nodeSetDofs.get(nodeSets, name, offset);
+    }
     // not used; just completing concrete impl
     const Albany::NodeSetGIDsList& getNodeSetGIDs() const { return nodeSetGIDs; };
 
@@ -460,6 +463,7 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     Albany::NodeSetList nodeSets;
     Albany::NodeSetGIDsList nodeSetGIDs; // not used
     Albany::NodeSetCoordList nodeSetCoords;
+    Albany::NodeSetDofs nodeSetDofs;
 
     //! side sets stored as std::map(string ID, SideArray classes) per workset (std::vector across worksets)
     std::vector<Albany::SideSetList> sideSets;
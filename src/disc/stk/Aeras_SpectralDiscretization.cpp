@@ -2953,6 +2953,7 @@ Aeras::SpectralDiscretization::determine_local_side_id(
 
 void Aeras::SpectralDiscretization::computeNodeSetsLines()
 {
+  nodeSetDofs.clear();
 #ifdef OUTPUT_TO_SCREEN
   *out << "DEBUG: " << __PRETTY_FUNCTION__ << std::endl;
 #endif
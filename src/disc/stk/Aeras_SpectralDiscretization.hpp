@@ -278,6 +278,11 @@ namespace Aeras
     {
       return nodeSetCoords;
     };
+    const std::vector<LO>& getNodeSetDofs(const std::string& name,
+                                          const int offset) const
+    {
+      return nodeSetDofs.get(nodeSets, name, offset);
+    };
     const Albany::NodeSetGIDsList& getNodeSetGIDs() const
     {
       return nodeSetGIDs;
@@ -752,6 +757,7 @@ namespace Aeras
     //! node sets stored as std::map(string ID, int vector of GIDs)
     Albany::NodeSetList nodeSets;
     Albany::NodeSetCoordList nodeSetCoords;
+    Albany::NodeSetDofs nodeSetDofs;
     Albany::NodeSetGIDsList nodeSetGIDs;
 
     //! side sets stored as std::map(string ID, SideArray classes) per
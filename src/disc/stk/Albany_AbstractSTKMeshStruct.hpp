@@ -62,6 +62,18 @@ namespace Albany {
     bool exoOutput;
     std::string exoOutFile;
     int exoOutputInterval;
+    //! Exodus output written in single precision and/or compressed, and
+    //! restricted to some element blocks and fields (all if empty)
+    bool exoSinglePrecision;
+    int exoCompressionLevel;
+    std::vector<std::string> exoOutputBlocks;
+    std::vector<std::string> exoOutputFields;
+    //! Separate full precision file with only the fields needed to restart
+    bool exoRestartOutput;
+    std::string exoRestartFile;
+    int exoRestartInterval;
+    bool exoRestartSingleFile;
+    std::vector<std::string> exoRestartFields;
     std::string cdfOutFile;
     bool cdfOutput;
     unsigned nLat;
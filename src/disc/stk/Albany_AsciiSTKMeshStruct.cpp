@@ -6,6 +6,10 @@
 
 
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "Albany_AsciiSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -42,6 +46,52 @@
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
+namespace {
+
+// Reads the rows of one of the mesh files: a header line, whose first value is
+// the number of rows, followed by one row per line. The first numCols values
+// of the first numRows rows (all of them if numRows<0) are stored in values,
+// and the number of rows is returned; like sscanf, any further values on a
+// row are ignored, but a row with fewer values is an error. The file is read
+// at once and parsed in memory, rather than with one fgets/sscanf per line.
+int readRows (FILE* file, const int numCols, std::vector<double>& values, int numRows = -1)
+{
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  std::string buffer(size, '\0');
+  TEUCHOS_TEST_FOR_EXCEPTION(long(fread(&buffer[0], 1, size, file)) != size, std::runtime_error,
+      "Error in AsciiSTKMeshStruct: cannot read mesh file" << std::endl);
+
+  const char* p = buffer.c_str();
+  const char* end = p + size;
+  char* next;
+  const int headerRows = int(std::strtod(p, &next));
+  if (numRows < 0) numRows = headerRows;
+  values.resize(numRows*numCols);
+
+  p = static_cast<const char*>(memchr(p, '\n', end-p));
+  for (int i=0; i<numRows; i++) {
+    TEUCHOS_TEST_FOR_EXCEPTION(p == NULL || p+1 == end, std::runtime_error,
+        "Error in AsciiSTKMeshStruct: mesh file has fewer than " << numRows << " rows" << std::endl);
+    ++p;
+    // strtod skips newlines, so a value that ends past the end of the row
+    // was taken from the next one
+    const char* rowEnd = static_cast<const char*>(memchr(p, '\n', end-p));
+    if (rowEnd == NULL) rowEnd = end;
+    for (int j=0; j<numCols; j++, p=next) {
+      values[i*numCols+j] = std::strtod(p, &next);
+      TEUCHOS_TEST_FOR_EXCEPTION(next == p || next > rowEnd, std::runtime_error,
+          "Error in AsciiSTKMeshStruct: row " << i+1 << " of mesh file has " << j
+          << " values, expected " << numCols << std::endl);
+    }
+    p = rowEnd < end ? rowEnd : NULL;
+  }
+  return numRows;
+}
+
+} // namespace
+
 
 //Constructor for meshes read from ASCII file
 Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
@@ -104,19 +154,17 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
           std::endl << "Error in AsciiSTKMeshStruct: coordinates file " << meshfilename << " not found!"<< std::endl);
     }
     double temp;
-    fseek(meshfile, 0, SEEK_SET);
-    safe_fscanf(1, meshfile, "%lf", &temp);
-    NumNodes = int(temp);
+    std::vector<double> rows;
+    NumNodes = readRows(meshfile, 3, rows);
 #ifdef OUTPUT_TO_SCREEN
     *out << "numNodes: " << NumNodes << std::endl;
 #endif
     xyz = new double[NumNodes][3];
     char buffer[100];
-    safe_fgets(buffer, 100, meshfile);
     for (int i=0; i<NumNodes; i++){
-      safe_fgets(buffer, 100, meshfile);
-      safe_sscanf(3, buffer, "%lf %lf %lf", &xyz[i][0], &xyz[i][1], &xyz[i][2]);
-      //*out << "i: " << i << ", x: " << xyz[i][0] << ", y: " << xyz[i][1] << ", z: " << xyz[i][2] << std::endl;
+      xyz[i][0] = rows[3*i];
+      xyz[i][1] = rows[3*i+1];
+      xyz[i][2] = rows[3*i+2];
      }
     //read in surface height data from mesh
     //assumes surface height file is called "sh" and its first row is the number of nodes
@@ -124,9 +172,7 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
     have_sh = false;
     if (shfile != NULL) have_sh = true;
     if (have_sh) {
-      fseek(shfile, 0, SEEK_SET);
-      safe_fscanf(1, shfile, "%lf", &temp);
-      int NumNodesSh = int(temp);
+      int NumNodesSh = readRows(shfile, 1, rows);
 #ifdef OUTPUT_TO_SCREEN
       *out << "NumNodesSh: " << NumNodesSh<< std::endl;
 #endif
@@ -136,12 +182,8 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
             std::endl << "Error in AsciiSTKMeshStruct: sh file must have same number nodes as xyz file!  numNodes in xyz = " << NumNodes << ", numNodes in sh = "<< NumNodesSh << std::endl);
       }
       sh = new double[NumNodes];
-      safe_fgets(buffer, 100, shfile);
-      for (int i=0; i<NumNodes; i++){
-        safe_fgets(buffer, 100, shfile);
-        safe_sscanf(1, buffer, "%lf", &sh[i]);
-        //*out << "i: " << i << ", sh: " << sh[i] << std::endl;
-       }
+      for (int i=0; i<NumNodes; i++)
+        sh[i] = rows[i];
      }
      //read in connectivity file -- right now hard coded for 3D hexes
      //assumes mesh file is called "eles" and its first row is the number of elements
@@ -151,20 +193,14 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
       TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
           std::endl << "Error in AsciiSTKMeshStruct: element connectivity file " << confilename << " not found!"<< std::endl);
      }
-     fseek(confile, 0, SEEK_SET);
-     safe_fscanf(1, confile, "%lf", &temp);
-     NumEles = int(temp);
+     NumEles = readRows(confile, 8, rows);
 #ifdef OUTPUT_TO_SCREEN
      *out << "numEles: " << NumEles << std::endl;
 #endif
      eles = new int[NumEles][8];
-     safe_fgets(buffer, 100, confile);
-     for (int i=0; i<NumEles; i++){
-        safe_fgets(buffer, 100, confile);
-        safe_sscanf(8, buffer, "%i %i %i %i %i %i %i %i", &eles[i][0], &eles[i][1], &eles[i][2], &eles[i][3], &eles[i][4], &eles[i][5], &eles[i][6], &eles[i][7]);
-        //*out << "elt # " << i << ": " << eles[i][0] << " " << eles[i][1] << " " << eles[i][2] << " " << eles[i][3] << " " << eles[i][4] << " "
-        //                  << eles[i][5] << " " << eles[i][6] << " " << eles[i][7] << std::endl;
-     }
+     for (int i=0; i<NumEles; i++)
+       for (int j=0; j<8; j++)
+         eles[i][j] = int(rows[8*i+j]);
     //read in basal face connectivity file from ascii file
     //assumes basal face connectivity file is called "bf" and its first row is the number of faces on basal boundary
     FILE *bffile = fopen(bffilename,"r");
@@ -201,14 +237,9 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
          TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
             std::endl << "Error in AsciiSTKMeshStruct: global element IDs file " << geIDsfilename << " not found!"<< std::endl);
        }
-       fseek(geIDsfile, 0, SEEK_SET);
-       safe_fgets(buffer, 100, geIDsfile);
-       for (int i=0; i<NumEles; i++){
-         safe_fgets(buffer, 100, geIDsfile);
-         safe_sscanf(1, buffer, "" ST_LLI" ", &globalElesID[i]);
-         globalElesID[i] = globalElesID[i]-1; //subtract 1 b/c global element IDs file assumed to be 1-based not 0-based
-         //*out << "local element ID #:" << i << ", global element ID #:" << globalElesID[i] << std::endl;
-       }
+       readRows(geIDsfile, 1, rows, NumEles);
+       for (int i=0; i<NumEles; i++)
+         globalElesID[i] = GO(rows[i])-1; //subtract 1 b/c global element IDs file assumed to be 1-based not 0-based
      }
      //Create array w/ global node IDs
      globalNodesID.resize(NumNodes);
@@ -226,14 +257,9 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
          TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
             std::endl << "Error in AsciiSTKMeshStruct: global node IDs file " << gnIDsfilename << " not found!"<< std::endl);
        }
-       fseek(gnIDsfile, 0, SEEK_SET);
-       safe_fgets(buffer, 100, gnIDsfile);
-       for (int i=0; i<NumNodes; i++){
-         safe_fgets(buffer, 100, gnIDsfile);
-         safe_sscanf(1, buffer, "" ST_LLI" ", &globalNodesID[i]);
-         globalNodesID[i] = globalNodesID[i]-1; //subtract 1 b/c global node IDs file assumed to be 1-based not 0-based
-         //*out << "local node ID #:" << i << ", global node ID #:" << globalNodesID[i] << std::endl;
-       }
+       readRows(gnIDsfile, 1, rows, NumNodes);
+       for (int i=0; i<NumNodes; i++)
+         globalNodesID[i] = GO(rows[i])-1; //subtract 1 b/c global node IDs file assumed to be 1-based not 0-based
      }
      basalFacesID.resize(NumBasalFaces);
      if ((numProc == 1) & (contigIDs == true)) { //serial run with contiguous global IDs: element IDs are just 0->NumEles-1
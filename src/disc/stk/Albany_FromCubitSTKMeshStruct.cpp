@@ -108,6 +108,11 @@ Albany::FromCubitSTKMeshStruct::FromCubitSTKMeshStruct(
   exoOutput = params->isType<string>("Exodus Output File Name");
   if (exoOutput)
     exoOutFile = params->get<string>("Exodus Output File Name");
+  exoSinglePrecision = false;
+  exoCompressionLevel = 0;
+  exoRestartOutput = false;
+  exoRestartInterval = 1;
+  exoRestartSingleFile = false;
   cdfOutput = params->isType<string>("NetCDF Output File Name");
   if (cdfOutput) 
     cdfOutFile = params->get<string>("NetCDF Output File Name");
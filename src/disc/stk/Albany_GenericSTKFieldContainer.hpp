@@ -10,6 +10,8 @@
 #include "Albany_AbstractSTKFieldContainer.hpp"
 #include "Teuchos_ParameterList.hpp"
 
+#include <vector>
+
 
 // Start of STK stuff
 #include <stk_mesh/base/Types.hpp>
@@ -180,6 +182,22 @@ class GenericSTKFieldContainer : public AbstractSTKFieldContainer {
     int neq;
     int numDim;
 
+  private:
+
+    // Local ids in node_map of the nodes of bucket (-1 if not in the map),
+    // computed on first use and kept until the mesh is modified, so that the
+    // Tpetra transfers above do not look up the map for every node.
+    const std::vector<LO>& getBucketNodeLIDs(const stk::mesh::Bucket& bucket,
+                                             const Teuchos::RCP<const Tpetra_Map>& node_map);
+
+    struct NodeTransferPlan {
+      Teuchos::RCP<const Tpetra_Map> map;
+      std::vector<std::vector<LO> > bucketLIDs; // indexed by bucket id
+    };
+
+    std::vector<NodeTransferPlan> nodeTransferPlans;
+    std::size_t planSyncCount;
+
 };
 
 // interleaved version
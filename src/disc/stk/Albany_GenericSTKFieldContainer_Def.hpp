@@ -31,13 +31,52 @@ Albany::GenericSTKFieldContainer<Interleaved>::GenericSTKFieldContainer(
     bulkData(bulkData_),
     params(params_),
     neq(neq_),
-    numDim(numDim_) {
+    numDim(numDim_),
+    planSyncCount(0) {
 }
 
 template<bool Interleaved>
 Albany::GenericSTKFieldContainer<Interleaved>::~GenericSTKFieldContainer() {
 }
 
+template<bool Interleaved>
+const std::vector<LO>&
+Albany::GenericSTKFieldContainer<Interleaved>::getBucketNodeLIDs(
+    const stk::mesh::Bucket& bucket, const Teuchos::RCP<const Tpetra_Map>& node_map) {
+
+  // The buckets only change in a modification cycle, which bumps the
+  // synchronized count: drop all the plans when that happens.
+  const std::size_t sync_count = bulkData->synchronized_count();
+  if (sync_count != planSyncCount) {
+    nodeTransferPlans.clear();
+    planSyncCount = sync_count;
+  }
+
+  NodeTransferPlan* plan = NULL;
+  for (std::size_t p = 0; p < nodeTransferPlans.size(); ++p)
+    if (nodeTransferPlans[p].map.get() == node_map.get()) {
+      plan = &nodeTransferPlans[p];
+      break;
+    }
+  if (plan == NULL) {
+    nodeTransferPlans.push_back(NodeTransferPlan());
+    plan = &nodeTransferPlans.back();
+    plan->map = node_map;
+    plan->bucketLIDs.resize(bulkData->buckets(stk::topology::NODE_RANK).size());
+  }
+
+  // Buckets are never empty, so an empty array has not been built yet
+  std::vector<LO>& lids = plan->bucketLIDs[bucket.bucket_id()];
+  if (lids.empty()) {
+    lids.resize(bucket.size());
+    for (std::size_t i = 0; i < bucket.size(); ++i) {
+      const GO node_gid = bulkData->identifier(bucket[i]) - 1;
+      lids[i] = node_map->getLocalElement(node_gid);
+    }
+  }
+  return lids;
+}
+
 #ifdef ALBANY_SEACAS
 namespace {
 //amb 13 Nov 2014. After new STK was integrated, fields with output set to false
@@ -325,17 +364,16 @@ Albany::GenericSTKFieldContainer<Interleaved>::fillVectorHelperT(Tpetra_Vector &
     const int num_vec_components = solution_array.dimension(0);
     const int num_nodes_in_bucket = solution_array.dimension(1);
 
-    stk::mesh::BulkData& mesh = solution_field->get_mesh();
+    const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
+    Teuchos::ArrayRCP<ST> solnT_nonConstView = solnT.get1dViewNonConst();
 
     for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
 
-      const GO node_gid = mesh.identifier(bucket[i]) - 1;
-      int node_lid = node_mapT->getLocalElement(node_gid);
-
-      for (std::size_t j=0; j<num_vec_components; j++) {
-        solnT.replaceLocalValue(getDOF(node_lid, offset+j), solution_array(j, i));
+      const LO node_lid = node_lids[i];
+      if (node_lid < 0) continue;
 
-      }
+      for (std::size_t j=0; j<num_vec_components; j++)
+        solnT_nonConstView[getDOF(node_lid, offset+j)] = solution_array(j, i);
     }
 }
 
@@ -348,23 +386,15 @@ Albany::GenericSTKFieldContainer<Interleaved>::saveVectorHelperT(
 
   BucketArray<T> field_array(*field, bucket);
   const int num_nodes_in_bucket = field_array.dimension(1);
+  const int num_components = nodalDofManager.numComponents();
 
-  stk::mesh::BulkData& mesh = field->get_mesh();
-
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_map);
   Teuchos::ArrayRCP<const ST> field_vector_constView = field_vector.get1dView();
-  for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    //      const unsigned node_gid = bucket[i].identifier();
-    const int node_gid = mesh.identifier(bucket[i]) - 1;
-#ifdef ALBANY_64BIT_INT
-    int node_lid = node_map->getLocalElement(static_cast<long long int>(node_gid));
-#else
-    int node_lid = node_map->getLocalElement(node_gid);
-#endif
-
 
+  for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
+    const LO node_lid = node_lids[i];
     if(node_lid>=0)
-      for(std::size_t j = 0; j < (std::size_t)nodalDofManager.numComponents(); j++)
+      for(std::size_t j = 0; j < num_components; j++)
         field_array(j,i) = field_vector_constView[nodalDofManager.getLocalDOF(node_lid,offset+j)];
   }
 }
@@ -377,15 +407,11 @@ void Albany::GenericSTKFieldContainer<Interleaved>::saveVectorHelperT(
   BucketArray<ScalarFieldType> field_array(*field, bucket);
   const int num_nodes_in_bucket = field_array.dimension(0);
 
-  stk::mesh::BulkData& mesh = field->get_mesh();
-
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, field_node_map);
   Teuchos::ArrayRCP<const ST> field_vector_constView = field_vector.get1dView();
-  for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    //      const unsigned node_gid = bucket[i].identifier();
-    const int node_gid = mesh.identifier(bucket[i]) - 1;
-    int node_lid = field_node_map->getLocalElement(node_gid);
 
+  for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
+    const LO node_lid = node_lids[i];
     if(node_lid>=0)
       field_array(i)=field_vector_constView[nodalDofManager.getLocalDOF(node_lid,offset)];
   }
@@ -410,17 +436,16 @@ Albany::GenericSTKFieldContainer<Interleaved>::fillMultiVectorHelper(Tpetra_Mult
     const int num_vec_components = solution_array.dimension(0);
     const int num_nodes_in_bucket = solution_array.dimension(1);
 
-    stk::mesh::BulkData& mesh = solution_field->get_mesh();
+    const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
+    Teuchos::ArrayRCP<ST> solnT_nonConstView = solnT.getDataNonConst(vector_component);
 
     for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
 
-      const GO node_gid = mesh.identifier(bucket[i]) - 1;
-      int node_lid = node_mapT->getLocalElement(node_gid);
+      const LO node_lid = node_lids[i];
+      if (node_lid < 0) continue;
 
-      for (std::size_t j=0; j<num_vec_components; j++) {
-        solnT.replaceLocalValue(getDOF(node_lid, offset+j), vector_component, solution_array(j, i));
-
-      }
+      for (std::size_t j=0; j<num_vec_components; j++)
+        solnT_nonConstView[getDOF(node_lid, offset+j)] = solution_array(j, i);
     }
 }
 
@@ -593,18 +618,16 @@ Albany::GenericSTKFieldContainer<Interleaved>::fillVectorHelperT(
 
   BucketArray<T> field_array(*field, bucket);
   const int num_nodes_in_bucket = field_array.dimension(1);
+  const int num_components = nodalDofManager.numComponents();
 
-  stk::mesh::BulkData& mesh = field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_map);
+  Teuchos::ArrayRCP<ST> field_vector_nonConstView = field_vector.get1dViewNonConst();
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    //      const unsigned node_gid = bucket[i].identifier();
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-    int node_lid = node_map->getLocalElement(node_gid);
-
+    const LO node_lid = node_lids[i];
     if(node_lid>=0)
-      for(std::size_t j = 0; j < (std::size_t)nodalDofManager.numComponents(); j++)
-        field_vector.replaceLocalValue(nodalDofManager.getLocalDOF(node_lid,offset+j), field_array(j,i));
+      for(std::size_t j = 0; j < num_components; j++)
+        field_vector_nonConstView[nodalDofManager.getLocalDOF(node_lid,offset+j)] = field_array(j,i);
   }
 
 }
@@ -617,16 +640,13 @@ void Albany::GenericSTKFieldContainer<Interleaved>::fillVectorHelperT(
   BucketArray<ScalarFieldType> field_array(*field, bucket);
   const int num_nodes_in_bucket = field_array.dimension(0);
 
-  stk::mesh::BulkData& mesh = field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_map);
+  Teuchos::ArrayRCP<ST> field_vector_nonConstView = field_vector.get1dViewNonConst();
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    //      const unsigned node_gid = bucket[i].identifier();
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-    int node_lid = node_map->getLocalElement(node_gid);
-
+    const LO node_lid = node_lids[i];
     if(node_lid>=0)
-      field_vector.replaceLocalValue(nodalDofManager.getLocalDOF(node_lid,offset), field_array(i));
+      field_vector_nonConstView[nodalDofManager.getLocalDOF(node_lid,offset)] = field_array(i);
   }
 }
 
@@ -649,20 +669,16 @@ Albany::GenericSTKFieldContainer<Interleaved>::saveVectorHelperT(const Tpetra_Ve
   const int num_vec_components = solution_array.dimension(0);
   const int num_nodes_in_bucket = solution_array.dimension(1);
 
-  stk::mesh::BulkData& mesh = solution_field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
 
   //get const (read-only) view of solnT
   Teuchos::ArrayRCP<const ST> solnT_constView = solnT.get1dView();
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-
-    if(node_mapT->getLocalElement(node_gid) != Teuchos::OrdinalTraits<LO>::invalid()){
-      int node_lid = node_mapT->getLocalElement(node_gid);
+    const LO node_lid = node_lids[i];
+    if(node_lid >= 0)
       for(std::size_t j = 0; j < num_vec_components; j++)
         solution_array(j, i) = solnT_constView[getDOF(node_lid, offset + j)];
-    }
   }
 }
 
@@ -683,19 +699,15 @@ void Albany::GenericSTKFieldContainer<Interleaved>::saveVectorHelperT(const Tpet
 
   const int num_nodes_in_bucket = solution_array.dimension(0);
 
-  stk::mesh::BulkData& mesh = solution_field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
 
   //get const (read-only) view of solnT
   Teuchos::ArrayRCP<const ST> solnT_constView = solnT.get1dView();
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-
-    if(node_mapT->getLocalElement(node_gid) != Teuchos::OrdinalTraits<LO>::invalid()){
-      int node_lid = node_mapT->getLocalElement(node_gid);
+    const LO node_lid = node_lids[i];
+    if(node_lid >= 0)
       solution_array(i) = solnT_constView[getDOF(node_lid, offset)];
-    }
   }
 }
 
@@ -718,22 +730,16 @@ Albany::GenericSTKFieldContainer<Interleaved>::saveMultiVectorHelper(const Tpetr
   const int num_vec_components = solution_array.dimension(0);
   const int num_nodes_in_bucket = solution_array.dimension(1);
 
-  stk::mesh::BulkData& mesh = solution_field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
 
-  Teuchos::RCP<const Tpetra_Vector> solnT = solnMV.getVector(vector_component);
-
-  //get const (read-only) view of solnT
-  Teuchos::ArrayRCP<const ST> solnT_constView = solnT->get1dView();
+  //get const (read-only) view of the vector_component column
+  Teuchos::ArrayRCP<const ST> solnT_constView = solnMV.getData(vector_component);
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-
-    if(node_mapT->getLocalElement(node_gid) != Teuchos::OrdinalTraits<LO>::invalid()){
-      int node_lid = node_mapT->getLocalElement(node_gid);
+    const LO node_lid = node_lids[i];
+    if(node_lid >= 0)
       for(std::size_t j = 0; j < num_vec_components; j++)
         solution_array(j, i) = solnT_constView[getDOF(node_lid, offset + j)];
-    }
   }
 }
 
@@ -754,21 +760,15 @@ void Albany::GenericSTKFieldContainer<Interleaved>::saveMultiVectorHelper(const
 
   const int num_nodes_in_bucket = solution_array.dimension(0);
 
-  stk::mesh::BulkData& mesh = solution_field->get_mesh();
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
 
-  Teuchos::RCP<const Tpetra_Vector> solnT = solnMV.getVector(vector_component);
-
-  //get const (read-only) view of solnT
-  Teuchos::ArrayRCP<const ST> solnT_constView = solnT->get1dView();
+  //get const (read-only) view of the vector_component column
+  Teuchos::ArrayRCP<const ST> solnT_constView = solnMV.getData(vector_component);
 
   for(std::size_t i = 0; i < num_nodes_in_bucket; i++)  {
-
-    const GO node_gid = mesh.identifier(bucket[i]) - 1;
-
-    if(node_mapT->getLocalElement(node_gid) != Teuchos::OrdinalTraits<LO>::invalid()){
-      int node_lid = node_mapT->getLocalElement(node_gid);
+    const LO node_lid = node_lids[i];
+    if(node_lid >= 0)
       solution_array(i) = solnT_constView[getDOF(node_lid, offset)];
-    }
   }
 }
 
@@ -788,18 +788,16 @@ void Albany::GenericSTKFieldContainer<Interleaved>::fillVectorHelperT(Tpetra_Vec
 
   BucketArray<ScalarFieldType> solution_array(*solution_field, bucket);
 
-   const int num_nodes_in_bucket = solution_array.dimension(0);
-
-   stk::mesh::BulkData& mesh = solution_field->get_mesh();
-
-    for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
-
-      const GO node_gid = mesh.identifier(bucket[i]) - 1;
-      int node_lid = node_mapT->getLocalElement(node_gid);
+  const int num_nodes_in_bucket = solution_array.dimension(0);
 
-      solnT.replaceLocalValue(getDOF(node_lid, offset), solution_array(i));
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
+  Teuchos::ArrayRCP<ST> solnT_nonConstView = solnT.get1dViewNonConst();
 
-    }
+  for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
+    const LO node_lid = node_lids[i];
+    if (node_lid >= 0)
+      solnT_nonConstView[getDOF(node_lid, offset)] = solution_array(i);
+  }
 }
 
 template<bool Interleaved>
@@ -816,18 +814,16 @@ void Albany::GenericSTKFieldContainer<Interleaved>::fillMultiVectorHelper(Tpetra
 
   BucketArray<ScalarFieldType> solution_array(*solution_field, bucket);
 
-   const int num_nodes_in_bucket = solution_array.dimension(0);
-
-   stk::mesh::BulkData& mesh = solution_field->get_mesh();
-
-    for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
-
-      const GO node_gid = mesh.identifier(bucket[i]) - 1;
-      int node_lid = node_mapT->getLocalElement(node_gid);
+  const int num_nodes_in_bucket = solution_array.dimension(0);
 
-      solnT.replaceLocalValue(getDOF(node_lid, offset), vector_component, solution_array(i));
+  const std::vector<LO>& node_lids = getBucketNodeLIDs(bucket, node_mapT);
+  Teuchos::ArrayRCP<ST> solnT_nonConstView = solnT.getDataNonConst(vector_component);
 
-    }
+  for (std::size_t i=0; i < num_nodes_in_bucket; i++)  {
+    const LO node_lid = node_lids[i];
+    if (node_lid >= 0)
+      solnT_nonConstView[getDOF(node_lid, offset)] = solution_array(i);
+  }
 }
 
 template<bool Interleaved>
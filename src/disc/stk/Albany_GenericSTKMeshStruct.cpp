@@ -196,6 +196,26 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
   if (exoOutput)
     exoOutFile = params->get<std::string>("Exodus Output File Name");
   exoOutputInterval = params->get<int>("Exodus Write Interval", 1);
+
+  const std::string exoPrecision = params->get<std::string>("Exodus Output Precision", "Double");
+  TEUCHOS_TEST_FOR_EXCEPTION(exoPrecision != "Double" && exoPrecision != "Single",
+      std::logic_error, "Error! Exodus Output Precision must be Double or Single.\n");
+  exoSinglePrecision = (exoPrecision == "Single");
+  exoCompressionLevel = params->get<int>("Exodus Compression Level", 0);
+  TEUCHOS_TEST_FOR_EXCEPTION(exoCompressionLevel < 0 || exoCompressionLevel > 9,
+      std::logic_error, "Error! Exodus Compression Level must be in [0,9].\n");
+  Teuchos::Array<std::string> noNames;
+  exoOutputBlocks = params->get<Teuchos::Array<std::string> >("Exodus Output Element Blocks", noNames).toVector();
+  exoOutputFields = params->get<Teuchos::Array<std::string> >("Exodus Output Fields", noNames).toVector();
+
+  exoRestartOutput = params->isType<std::string>("Exodus Restart Output File Name");
+  if (exoRestartOutput)
+    exoRestartFile = params->get<std::string>("Exodus Restart Output File Name");
+  exoRestartInterval = params->get<int>("Exodus Restart Write Interval", exoOutputInterval);
+  exoRestartSingleFile = params->get<bool>("Exodus Restart Single File", false);
+  if (params->isType<Teuchos::Array<std::string> >("Restart Fields"))
+    exoRestartFields = params->get<Teuchos::Array<std::string> >("Restart Fields").toVector();
+
   cdfOutput = params->isType<std::string>("NetCDF Output File Name");
   if (cdfOutput)
     cdfOutFile = params->get<std::string>("NetCDF Output File Name");
@@ -1766,6 +1786,19 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
       "Name of solution_dotdot dtk written to Exodus file. Requires SEACAS build");
 #endif
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<std::string>("Exodus Output Precision", "Double",
+      "Floating point precision of the Exodus output file: Double or Single");
+  validPL->set<int>("Exodus Compression Level", 0,
+      "Lossless (zlib) compression level, 0 to 9, of the Exodus output and restart files; writes netCDF-4 files if positive");
+  validPL->set<Teuchos::Array<std::string> >("Exodus Output Element Blocks", Teuchos::Array<std::string>(),
+      "Element blocks written to the Exodus output file (default all)");
+  validPL->set<Teuchos::Array<std::string> >("Exodus Output Fields", Teuchos::Array<std::string>(),
+      "Fields written to the Exodus output file (default all output fields)");
+  validPL->set<std::string>("Exodus Restart Output File Name", "",
+      "Request a full precision Exodus file with the nodal fields and the Restart Fields only");
+  validPL->set<int>("Exodus Restart Write Interval", 3, "Step interval to write the Exodus restart file");
+  validPL->set<bool>("Exodus Restart Single File", false,
+      "Write one restart file for all ranks instead of one per rank, so that it can be read back on any number of ranks");
   validPL->set<std::string>("NetCDF Output File Name", "",
       "Request NetCDF output to given file name. Requires SEACAS build");
   validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file");
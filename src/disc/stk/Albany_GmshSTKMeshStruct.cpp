@@ -6,6 +6,13 @@
 
 
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
 
 #include "Albany_GmshSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -20,6 +27,7 @@
 #include <stk_mesh/base/Selector.hpp>
 
 #include <Albany_STKNodeSharing.hpp>
+#include <stk_util/parallel/CommSparse.hpp>
 
 #ifdef ALBANY_SEACAS
 #include <stk_io/IossBridge.hpp>
@@ -30,12 +38,146 @@
 
 #include "Albany_Utils.hpp"
 
+namespace
+{
+
+// Number of nodes of the Gmsh element types read by this class; -1 for the others
+int gmshTypeNodes (const int e_type)
+{
+  switch (e_type)
+  {
+    case 1:  return 2; // 2-pt Line
+    case 2:  return 3; // 3-pt Triangle
+    case 3:  return 4; // 4-pt Quad
+    case 4:  return 4; // 4-pt Tetra
+    case 5:  return 8; // 8-pt Hexa
+    case 15: return 1; // Point
+    default: return -1;
+  }
+}
+
+const CellTopologyData* gmshCellTopology (const int numElemNodes, const int numSideNodes)
+{
+  switch (numElemNodes)
+  {
+    case 3:
+      return shards::getCellTopologyData<shards::Triangle<3> >();
+    case 4:
+      if (numSideNodes==3)
+        return shards::getCellTopologyData<shards::Tetrahedron<4> >();
+      return shards::getCellTopologyData<shards::Quadrilateral<4> >();
+    case 8:
+      return shards::getCellTopologyData<shards::Hexahedron<8> >();
+    default:
+      return NULL;
+  }
+}
+
+// Offset in the file of the first line equal to each of the markers, or -1.
+// Every rank scans its share of the file.
+std::vector<long long> findMarkers (const std::string& fname,
+                                    const std::vector<std::string>& markers,
+                                    const Teuchos_Comm& comm)
+{
+  std::ifstream ifile (fname.c_str(), std::ios::binary);
+  TEUCHOS_TEST_FOR_EXCEPTION (!ifile.is_open(), std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
+  ifile.seekg (0, std::ios::end);
+  const long long size = ifile.tellg();
+
+  size_t maxLength = 0;
+  for (size_t k(0); k<markers.size(); ++k)
+    maxLength = std::max(maxLength, markers[k].size());
+
+  // Read also the character before the range, to see if a line starts at its
+  // beginning, and enough after it to see a marker crossing its end
+  const long long b = size*comm.getRank()/comm.getSize();
+  const long long e = size*(comm.getRank()+1)/comm.getSize();
+  const long long first = std::max(b-1, 0LL);
+  const long long last  = std::min(e+static_cast<long long>(maxLength)+1, size);
+  std::string buf (last-first, '\0');
+  ifile.seekg (first);
+  if (!buf.empty())
+    ifile.read (&buf[0], buf.size());
+
+  const long long none = std::numeric_limits<long long>::max();
+  std::vector<long long> localOffsets (markers.size(), none), offsets (markers.size());
+  for (size_t k(0); k<markers.size(); ++k)
+  {
+    const std::string& m = markers[k];
+    for (size_t pos=buf.find(m); pos!=std::string::npos; pos=buf.find(m,pos+1))
+    {
+      const long long offset = first + pos;
+      if (offset<b || offset>=e)
+        continue;
+      const size_t end = pos + m.size();
+      if ((offset==0 || buf[pos-1]=='\n') &&
+          (end==buf.size() || buf[end]=='\n' || buf[end]=='\r'))
+      {
+        localOffsets[k] = offset;
+        break;
+      }
+    }
+  }
+  Teuchos::reduceAll<int,long long>(comm, Teuchos::REDUCE_MIN, markers.size(), &localOffsets[0], &offsets[0]);
+
+  for (size_t k(0); k<markers.size(); ++k)
+    if (offsets[k]==none)
+      offsets[k] = -1;
+  return offsets;
+}
+
+// The lines of the range [begin,end) of the file that start in this rank's
+// share of it
+std::string readLines (std::ifstream& ifile, const long long begin, const long long end,
+                       const int rank, const int size)
+{
+  long long b = begin + (end-begin)*rank/size;
+  const long long e = begin + (end-begin)*(rank+1)/size;
+
+  std::string buf;
+  ifile.clear();
+  if (b>begin)
+  {
+    // Skip the end of the line started in the share of the previous rank
+    std::string partial;
+    ifile.seekg (b-1);
+    std::getline (ifile, partial);
+    b += partial.size();
+  }
+  if (b>=e)
+    return buf;
+
+  buf.resize (e-b);
+  ifile.seekg (b);
+  ifile.read (&buf[0], e-b);
+  if (buf[buf.size()-1]!='\n')
+  {
+    // Finish the last line
+    std::string rest;
+    std::getline (ifile, rest);
+    buf += rest;
+    buf += '\n';
+  }
+  return buf;
+}
+
+} // namespace
+
 Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::ParameterList>& params,
                                               const Teuchos::RCP<const Teuchos_Comm>& commT) :
-  GenericSTKMeshStruct (params, Teuchos::null)
+  GenericSTKMeshStruct (params, Teuchos::null),
+  pts (NULL),
+  hexas (NULL),
+  tetra (NULL),
+  quads (NULL),
+  trias (NULL),
+  lines (NULL)
 {
   std::string fname = params->get("Gmsh Input Mesh File Name", "mesh.msh");
+  parallelRead = params->get("Parallel Read", false);
 
+  // Format of the file: legacy, binary, version
+  int format[3] = {0, 0, 0};
   if (commT->getRank() == 0)
   {
     std::ifstream ifile;
@@ -63,6 +205,7 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
       float version;
       int doublesize;
       iss >> version >> binary >> doublesize;
+      format[2] = static_cast<int>(version);
     }
     else
     {
@@ -70,9 +213,22 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
     }
     ifile.close();
 
-    if (legacy)
+    format[0] = legacy;
+    format[1] = binary;
+  }
+  Teuchos::broadcast<int,int>(*commT, 0, 3, format);
+
+  // Only $MeshFormat 2 files can be read in parallel
+  parallelRead = parallelRead && format[0]==0 && format[2]==2;
+  if (parallelRead)
+  {
+    loadMeshParallel (fname, format[1], commT);
+  }
+  else if (commT->getRank() == 0)
+  {
+    if (format[0])
       loadLegacyMesh (fname);
-    else if (binary)
+    else if (format[1])
       loadBinaryMesh (fname);
     else
       loadAsciiMesh (fname);
@@ -121,8 +277,29 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
   // Counting boundaries
   std::set<int> bdTags;
-  for (int i(0); i<NumSides; ++i)
-    bdTags.insert(sides[NumSideNodes][i]);
+  if (parallelRead)
+  {
+    // Every rank has some of the sides: gather the tags on all ranks
+    int maxTag = -1;
+    for (int i(0); i<NumSides; ++i)
+      maxTag = std::max(maxTag, localSideTags[i]);
+    int globalMaxTag;
+    Teuchos::reduceAll<int,int>(*commT, Teuchos::REDUCE_MAX, 1, &maxTag, &globalMaxTag);
+
+    std::vector<int> localUsed(globalMaxTag+1, 0), used(globalMaxTag+1, 0);
+    for (int i(0); i<NumSides; ++i)
+      localUsed[localSideTags[i]] = 1;
+    if (globalMaxTag >= 0)
+      Teuchos::reduceAll<int,int>(*commT, Teuchos::REDUCE_MAX, globalMaxTag+1, &localUsed[0], &used[0]);
+    for (int tag(0); tag<=globalMaxTag; ++tag)
+      if (used[tag])
+        bdTags.insert(tag);
+  }
+  else
+  {
+    for (int i(0); i<NumSides; ++i)
+      bdTags.insert(sides[NumSideNodes][i]);
+  }
 
   // Broadcasting the tags
   int numBdTags = bdTags.size();
@@ -202,6 +379,10 @@ Albany::GmshSTKMeshStruct::~GmshSTKMeshStruct()
 {
   delete[] pts;
 
+  // Not allocated on the ranks that did not read the mesh
+  if (tetra==NULL)
+    return;
+
   for (int i(0); i<5; ++i)
     delete[] tetra[i];
   for (int i(0); i<5; ++i)
@@ -236,8 +417,69 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
 
   bulkData->modification_begin(); // Begin modifying the mesh
 
-  // Only proc 0 has loaded the file
-  if (commT->getRank()==0)
+  if (parallelRead)
+  {
+    // Every rank builds the cells it read, with their nodes and sides
+    stk::mesh::PartVector singlePartVec(1);
+    AbstractSTKFieldContainer::IntScalarFieldType* proc_rank_field = fieldContainer->getProcRankField();
+    AbstractSTKFieldContainer::VectorFieldType* coordinates_field =  fieldContainer->getCoordinatesField();
+
+    singlePartVec[0] = nsPartVec["Node"];
+    for (int i = 0; i < NumNodes; i++)
+    {
+      stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, localNodeIds[i], singlePartVec);
+
+      double* coord;
+      coord = stk::mesh::field_data(*coordinates_field, node);
+      coord[0] = localCoords[3*i];
+      coord[1] = localCoords[3*i+1];
+      if (numDim==3)
+        coord[2] = localCoords[3*i+2];
+    }
+
+    std::vector<stk::mesh::Entity> cells(NumElems);
+    singlePartVec[0] = partVec[0];
+    for (int i = 0; i < NumElems; i++)
+    {
+      cells[i] = bulkData->declare_entity(stk::topology::ELEMENT_RANK, localCellIds[i], singlePartVec);
+
+      for (int j = 0; j < NumElemNodes; j++)
+      {
+        stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, localCellNodes[i*NumElemNodes+j]);
+        bulkData->declare_relation(cells[i], node, j);
+      }
+
+      int* p_rank = stk::mesh::field_data(*proc_rank_field, cells[i]);
+      p_rank[0] = commT->getRank();
+    }
+
+    // The sides were sent to the rank of their cell, together with their
+    // ordinal in it
+    const CellTopologyData& ctd = *metaData->get_cell_topology(*partVec[0]).getCellTopologyData();
+    stk::mesh::PartVector nsPartVec_i(1), ssPartVec_i(2);
+    ssPartVec_i[0] = ssPartVec["BoundarySide"]; // The whole boundary side
+    for (int i = 0; i < NumSides; i++)
+    {
+      nsPartVec_i[0] = nsPartVec[bdTagToNodeSetName[localSideTags[i]]];
+      ssPartVec_i[1] = ssPartVec[bdTagToSideSetName[localSideTags[i]]];
+
+      stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), localSideIds[i], ssPartVec_i);
+      stk::mesh::Entity elem = cells[localSideCells[i]];
+      const int ordinal = localSideOrdinals[i];
+      const stk::mesh::Entity* elem_nodes = bulkData->begin_nodes(elem);
+      for (int j=0; j<NumSideNodes; ++j)
+      {
+        stk::mesh::Entity node_j = elem_nodes[ctd.side[ordinal].node[j]];
+        bulkData->change_entity_parts (node_j,nsPartVec_i); // Add node to the boundary nodeset
+        bulkData->declare_relation(side, node_j, j);
+      }
+      bulkData->declare_relation(elem, side, ordinal);
+    }
+
+    Albany::fix_node_sharing(*bulkData);
+  }
+  // Otherwise only proc 0 has loaded the file
+  else if (commT->getRank()==0)
   {
     stk::mesh::PartVector singlePartVec(1);
     unsigned int ebNo = 0; //element block #???
@@ -323,8 +565,9 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
   bulkData->modification_end();
 
 #ifdef ALBANY_ZOLTAN
-  // Gmsh is for sure using a serial mesh. We hard code it here, in case the user did not set it
-  params->set<bool>("Use Serial Mesh", true);
+  // Unless read in parallel, Gmsh is for sure using a serial mesh. We hard code it here, in case the user did not set it
+  if (!parallelRead)
+    params->set<bool>("Use Serial Mesh", true);
 
   // Refine the mesh before starting the simulation if indicated
   uniformRefineMesh(commT);
@@ -347,6 +590,8 @@ Teuchos::RCP<const Teuchos::ParameterList> Albany::GmshSTKMeshStruct::getValidDi
   Teuchos::RCP<Teuchos::ParameterList> validPL = this->getValidGenericSTKParameters("Valid ASCII_DiscParams");
   validPL->set<std::string>("Gmsh Input Mesh File Name", "mesh.msh",
       "Name of the file containing the 2D mesh, with list of coordinates, elements' connectivity and boundary edges' connectivity");
+  validPL->set<bool>("Parallel Read", false,
+      "Read a $MeshFormat 2 mesh file (ascii or binary) on all ranks, each rank reading a part of it, instead of on rank 0 only");
 
   return validPL;
 }
@@ -1015,3 +1260,443 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   // Close the input stream
   ifile.close();
 }
+
+void Albany::GmshSTKMeshStruct::loadMeshParallel (const std::string& fname, const bool binary,
+                                                  const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  const int rank = commT->getRank();
+  const int size = commT->getSize();
+
+  // Locate the nodes and elements sections. The first entries of sections are
+  // the beginning and end of the nodes records, the number of nodes, and the same
+  // for the elements; for binary files, they are followed by type, number of
+  // elements, number of tags and offset of every block of elements.
+  std::vector<long long> sections(6);
+  std::vector<long long> markers;
+  if (!binary)
+  {
+    std::vector<std::string> names = {"$Nodes", "$EndNodes", "$Elements", "$EndElements"};
+    markers = findMarkers (fname, names, *commT);
+  }
+
+  std::ifstream ifile (fname.c_str(), std::ios::binary);
+  if (!ifile.is_open())
+  {
+      TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
+  }
+
+  if (rank==0)
+  {
+    std::string line;
+    if (binary)
+    {
+      std::getline (ifile, line); // $MeshFormat
+      std::getline (ifile, line); // 2.0 file-type data-size
+
+      // Check file endianness
+      int one;
+      ifile.read (reinterpret_cast<char*> (&one), sizeof (int) );
+      TEUCHOS_TEST_FOR_EXCEPTION (one!=1, std::runtime_error, "Error! Uncompatible binary format.\n");
+
+      while (std::getline (ifile, line) && line != "$Nodes")
+      {
+        // Keep swallowing lines...
+      }
+      TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Nodes section not found.\n");
+      std::getline (ifile, line);
+      sections[2] = std::atoll (line.c_str() );
+      sections[0] = ifile.tellg();
+      sections[1] = sections[0] + sections[2]*(sizeof(int)+3*sizeof(double));
+
+      ifile.seekg (sections[1]);
+      while (std::getline (ifile, line) && line != "$Elements")
+      {
+        // Keep swallowing lines...
+      }
+      TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found.\n");
+      std::getline (ifile, line);
+      sections[5] = std::atoll (line.c_str() );
+      sections[3] = ifile.tellg();
+
+      // Jump from one block header to the next
+      long long entities_found = 0;
+      while (entities_found<sections[5])
+      {
+        int header[3];
+        ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
+
+        TEUCHOS_TEST_FOR_EXCEPTION (!ifile || header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
+        TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
+        const int n_nodes = gmshTypeNodes(header[0]);
+        TEUCHOS_TEST_FOR_EXCEPTION (n_nodes<0, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+
+        sections.push_back (header[0]);
+        sections.push_back (header[1]);
+        sections.push_back (header[2]);
+        sections.push_back (ifile.tellg());
+
+        entities_found += header[1];
+        ifile.seekg (static_cast<long long>(header[1])*(1+header[2]+n_nodes)*sizeof(int), std::ios::cur);
+      }
+      sections[4] = ifile.tellg();
+    }
+    else
+    {
+      TEUCHOS_TEST_FOR_EXCEPTION (markers[0]<0 || markers[1]<0, std::runtime_error, "Error! Nodes section not found.\n");
+      TEUCHOS_TEST_FOR_EXCEPTION (markers[2]<0 || markers[3]<0, std::runtime_error, "Error! Element section not found.\n");
+      for (int k(0); k<2; ++k)
+      {
+        ifile.seekg (markers[2*k]);
+        std::getline (ifile, line); // $Nodes or $Elements
+        std::getline (ifile, line);
+        sections[3*k+2] = std::atoll (line.c_str() );
+        sections[3*k]   = ifile.tellg();
+        sections[3*k+1] = markers[2*k+1];
+      }
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION (sections[2]<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
+    TEUCHOS_TEST_FOR_EXCEPTION (sections[5]<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
+  }
+
+  int numSections = sections.size();
+  Teuchos::broadcast<int,int>(*commT, 0, &numSections);
+  sections.resize(numSections);
+  Teuchos::broadcast<int,long long>(*commT, 0, numSections, &sections[0]);
+
+  // Read this rank's share of the nodes
+  std::vector<GO> readNodeIds;
+  std::vector<double> readCoords;
+  if (binary)
+  {
+    const long long recordSize = sizeof(int)+3*sizeof(double);
+    const long long first = sections[2]*rank/size;
+    const long long last  = sections[2]*(rank+1)/size;
+    std::vector<char> buf ((last-first)*recordSize);
+    ifile.clear();
+    ifile.seekg (sections[0]+first*recordSize);
+    if (!buf.empty())
+      ifile.read (&buf[0], buf.size());
+
+    readNodeIds.resize(last-first);
+    readCoords.resize(3*(last-first));
+    for (long long i(0); i<last-first; ++i)
+    {
+      int id;
+      std::memcpy (&id, &buf[i*recordSize], sizeof(int));
+      readNodeIds[i] = id;
+      std::memcpy (&readCoords[3*i], &buf[i*recordSize+sizeof(int)], 3*sizeof(double));
+    }
+  }
+  else
+  {
+    const std::string buf = readLines (ifile, sections[0], sections[1], rank, size);
+    const char* p = buf.c_str();
+    char* next;
+    while (true)
+    {
+      const long long id = std::strtoll (p, &next, 10);
+      if (next==p)
+        break;
+      p = next;
+      readNodeIds.push_back(id);
+      for (int d(0); d<3; ++d, p=next)
+        readCoords.push_back(std::strtod (p, &next));
+    }
+  }
+
+  // Read this rank's share of the entities: type, first tag and nodes (8 slots)
+  std::vector<int> types, tags;
+  std::vector<GO> nodes;
+  if (binary)
+  {
+    // The entities are counted across the blocks
+    const long long first = sections[5]*rank/size;
+    const long long last  = sections[5]*(rank+1)/size;
+    long long blockFirst = 0;
+    std::vector<int> buf;
+    for (int k(6); k<numSections; k+=4)
+    {
+      const int e_type = sections[k];
+      const long long count = sections[k+1];
+      const int n_tags = sections[k+2];
+      const long long lo = std::max(first, blockFirst);
+      const long long hi = std::min(last, blockFirst+count);
+      if (lo<hi)
+      {
+        const int n_nodes = gmshTypeNodes(e_type);
+        const int length = 1+n_tags+n_nodes; // id, tags, points
+        buf.resize((hi-lo)*length);
+        ifile.clear();
+        ifile.seekg (sections[k+3] + (lo-blockFirst)*length*sizeof(int));
+        ifile.read (reinterpret_cast<char*> (&buf[0]), buf.size()*sizeof(int));
+        for (long long j(0); j<hi-lo; ++j)
+        {
+          types.push_back(e_type);
+          tags.push_back(buf[j*length+1]); // Use first tag
+          for (int n(0); n<8; ++n)
+            nodes.push_back(n<n_nodes ? buf[j*length+1+n_tags+n] : 0);
+        }
+      }
+      blockFirst += count;
+    }
+  }
+  else
+  {
+    const std::string buf = readLines (ifile, sections[3], sections[4], rank, size);
+    const char* p = buf.c_str();
+    char* next;
+    while (true)
+    {
+      std::strtoll (p, &next, 10); // id
+      if (next==p)
+        break;
+      p = next;
+      const int e_type = std::strtol (p, &next, 10); p = next;
+      const int n_tags = std::strtol (p, &next, 10); p = next;
+      TEUCHOS_TEST_FOR_EXCEPTION (n_tags<=0, Teuchos::Exceptions::InvalidParameter, "Error! Number of tags must be positive.\n");
+      const int n_nodes = gmshTypeNodes(e_type);
+      TEUCHOS_TEST_FOR_EXCEPTION (n_nodes<0, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+
+      types.push_back(e_type);
+      for (int j(0); j<n_tags; ++j, p=next)
+      {
+        const int tag = std::strtol (p, &next, 10);
+        if (j==0)
+          tags.push_back(tag); // Use first tag
+      }
+      for (int n(0); n<8; ++n)
+      {
+        nodes.push_back(n<n_nodes ? std::strtoll (p, &next, 10) : 0);
+        if (n<n_nodes)
+          p = next;
+      }
+    }
+  }
+  ifile.close();
+
+  // Gmsh does not specify beforehand what kind of elements the mesh has: count
+  // the types over all ranks
+  long long localCount[6] = {0, 0, 0, 0, 0, 0}, count[6];
+  for (size_t i(0); i<types.size(); ++i)
+    if (types[i]<6)
+      ++localCount[types[i]];
+  Teuchos::reduceAll<int,long long>(*commT, Teuchos::REDUCE_SUM, 6, localCount, count);
+  const long long nb_line(count[1]), nb_tria(count[2]), nb_quad(count[3]), nb_tetra(count[4]), nb_hexa(count[5]);
+
+  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra*nb_hexa!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (nb_tria*nb_quad!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra+nb_hexa+nb_tria+nb_quad==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
+
+  int cellType, sideType;
+  if (nb_tetra>0)
+  {
+    this->numDim = 3;
+    cellType = 4;
+    sideType = 2;
+    NumElemNodes = 4;
+    NumSideNodes = 3;
+  }
+  else if (nb_hexa>0)
+  {
+    this->numDim = 3;
+    cellType = 5;
+    sideType = 3;
+    NumElemNodes = 8;
+    NumSideNodes = 4;
+  }
+  else if (nb_tria>0)
+  {
+    this->numDim = 2;
+    cellType = 2;
+    sideType = 1;
+    NumElemNodes = 3;
+    NumSideNodes = 2;
+  }
+  else
+  {
+    this->numDim = 2;
+    cellType = 3;
+    sideType = 1;
+    NumElemNodes = 4;
+    NumSideNodes = 2;
+  }
+
+  std::vector<GO> sideNodes;
+  std::vector<int> sideTags;
+  for (size_t i(0); i<types.size(); ++i)
+  {
+    if (types[i]==cellType)
+      localCellNodes.insert(localCellNodes.end(), &nodes[8*i], &nodes[8*i+NumElemNodes]);
+    else if (types[i]==sideType)
+    {
+      sideNodes.insert(sideNodes.end(), &nodes[8*i], &nodes[8*i+NumSideNodes]);
+      sideTags.push_back(tags[i]);
+    }
+  }
+  NumElems = localCellNodes.size()/NumElemNodes;
+  const int numReadSides = sideTags.size();
+
+  // Number cells and sides in file order, like the serial readers
+  GO localSizes[2] = {NumElems, numReadSides}, offsets[2];
+  Teuchos::scan<int,GO>(*commT, Teuchos::REDUCE_SUM, 2, localSizes, offsets);
+  localCellIds.resize(NumElems);
+  for (int i(0); i<NumElems; ++i)
+    localCellIds[i] = offsets[0] - NumElems + i + 1;
+
+  // Get the coordinates of the nodes of the local cells from the ranks that
+  // read them
+  localNodeIds = localCellNodes;
+  std::sort(localNodeIds.begin(), localNodeIds.end());
+  localNodeIds.erase(std::unique(localNodeIds.begin(), localNodeIds.end()), localNodeIds.end());
+  NumNodes = localNodeIds.size();
+
+  Teuchos::Array<GO> indices(readNodeIds.begin(), readNodeIds.end());
+  Teuchos::RCP<const Tpetra_Map> readMap = Tpetra::createNonContigMapWithNode<LO,GO>(indices(),commT,KokkosClassic::Details::getNode<KokkosNode>());
+  indices.assign(localNodeIds.begin(), localNodeIds.end());
+  Teuchos::RCP<const Tpetra_Map> cellNodesMap = Tpetra::createNonContigMapWithNode<LO,GO>(indices(),commT,KokkosClassic::Details::getNode<KokkosNode>());
+
+  Tpetra_MultiVector readCoordsT(readMap, 3), coordsT(cellNodesMap, 3);
+  for (size_t i(0); i<readNodeIds.size(); ++i)
+    for (int d(0); d<3; ++d)
+      readCoordsT.replaceLocalValue(i, d, readCoords[3*i+d]);
+  Tpetra_Import importer(readMap, cellNodesMap);
+  coordsT.doImport(readCoordsT, importer, Tpetra::INSERT);
+
+  localCoords.resize(3*NumNodes);
+  for (int d(0); d<3; ++d)
+  {
+    Teuchos::ArrayRCP<const ST> coords_d = coordsT.getData(d);
+    for (int i(0); i<NumNodes; ++i)
+      localCoords[3*i+d] = coords_d[i];
+  }
+
+  // Send every side to the rank of a cell having it as a side. Cell sides and
+  // sides read from the file meet on a rendezvous rank chosen by the smallest
+  // node of the side.
+  typedef std::array<GO,4> SideKey; // Sorted nodes, padded with zeros
+  const CellTopologyData& ctd = *gmshCellTopology(NumElemNodes, NumSideNodes);
+  const Teuchos::MpiComm<int>* mpiComm = dynamic_cast<const Teuchos::MpiComm<int>* > (commT.get());
+  TEUCHOS_TEST_FOR_EXCEPTION (mpiComm==NULL, std::logic_error, "Error! Parallel gmsh reading requires an MPI communicator.\n");
+  stk::CommSparse comm(*mpiComm->getRawMpiComm());
+  for (int phase(0); phase<2; ++phase)
+  {
+    for (int i(0); i<NumElems; ++i)
+    {
+      for (int ord(0); ord<ctd.side_count; ++ord)
+      {
+        SideKey key = {{0, 0, 0, 0}};
+        for (int j(0); j<NumSideNodes; ++j)
+          key[j] = localCellNodes[i*NumElemNodes+ctd.side[ord].node[j]];
+        std::sort(key.begin(), key.begin()+NumSideNodes);
+
+        stk::CommBuffer& buf = comm.send_buffer(key[0] % size);
+        buf.pack<int>(0);
+        for (int j(0); j<4; ++j)
+          buf.pack<GO>(key[j]);
+        buf.pack<int>(i);
+        buf.pack<int>(ord);
+      }
+    }
+    for (int i(0); i<numReadSides; ++i)
+    {
+      SideKey key = {{0, 0, 0, 0}};
+      std::copy(&sideNodes[i*NumSideNodes], &sideNodes[(i+1)*NumSideNodes], key.begin());
+      std::sort(key.begin(), key.begin()+NumSideNodes);
+
+      stk::CommBuffer& buf = comm.send_buffer(key[0] % size);
+      buf.pack<int>(1);
+      for (int j(0); j<4; ++j)
+        buf.pack<GO>(key[j]);
+      buf.pack<GO>(offsets[1] - numReadSides + i + 1);
+      buf.pack<int>(sideTags[i]);
+    }
+
+    if (phase==0)
+      comm.allocate_buffers();
+    else
+      comm.communicate();
+  }
+
+  // On the rendezvous rank: (rank, cell, ordinal) of the cell sides, and the sides read
+  std::map<SideKey,std::array<int,3> > cellSides;
+  std::vector<SideKey> readKeys;
+  std::vector<GO> readIds;
+  std::vector<int> readTags;
+  for (int p(0); p<size; ++p)
+  {
+    stk::CommBuffer& buf = comm.recv_buffer(p);
+    while (buf.remaining())
+    {
+      int kind;
+      SideKey key;
+      buf.unpack<int>(kind);
+      for (int j(0); j<4; ++j)
+        buf.unpack<GO>(key[j]);
+      if (kind==0)
+      {
+        std::array<int,3> cellSide = {{p, 0, 0}};
+        buf.unpack<int>(cellSide[1]);
+        buf.unpack<int>(cellSide[2]);
+        cellSides.insert(std::make_pair(key, cellSide));
+      }
+      else
+      {
+        GO id;
+        int tag;
+        buf.unpack<GO>(id);
+        buf.unpack<int>(tag);
+        readKeys.push_back(key);
+        readIds.push_back(id);
+        readTags.push_back(tag);
+      }
+    }
+  }
+
+  // Check all sides before any rank throws, so that no rank is left waiting
+  // in the reply below. Side ids are 1-based, 0 means all sides were found.
+  GO localMissing = 0, missing;
+  for (size_t i(0); i<readKeys.size() && localMissing==0; ++i)
+    if (cellSides.find(readKeys[i])==cellSides.end())
+      localMissing = readIds[i];
+  Teuchos::reduceAll<int,GO>(*commT, Teuchos::REDUCE_MAX, 1, &localMissing, &missing);
+  TEUCHOS_TEST_FOR_EXCEPTION (missing!=0, std::logic_error, "Error! Cannot find element connected to side " << missing << ".\n");
+
+  stk::CommSparse reply(*mpiComm->getRawMpiComm());
+  for (int phase(0); phase<2; ++phase)
+  {
+    for (size_t i(0); i<readKeys.size(); ++i)
+    {
+      std::map<SideKey,std::array<int,3> >::const_iterator it = cellSides.find(readKeys[i]);
+
+      stk::CommBuffer& buf = reply.send_buffer(it->second[0]);
+      buf.pack<GO>(readIds[i]);
+      buf.pack<int>(readTags[i]);
+      buf.pack<int>(it->second[1]);
+      buf.pack<int>(it->second[2]);
+    }
+
+    if (phase==0)
+      reply.allocate_buffers();
+    else
+      reply.communicate();
+  }
+
+  for (int p(0); p<size; ++p)
+  {
+    stk::CommBuffer& buf = reply.recv_buffer(p);
+    while (buf.remaining())
+    {
+      GO id;
+      int tag, cell, ordinal;
+      buf.unpack<GO>(id);
+      buf.unpack<int>(tag);
+      buf.unpack<int>(cell);
+      buf.unpack<int>(ordinal);
+      localSideIds.push_back(id);
+      localSideTags.push_back(tag);
+      localSideCells.push_back(cell);
+      localSideOrdinals.push_back(ordinal);
+    }
+  }
+  NumSides = localSideIds.size();
+}
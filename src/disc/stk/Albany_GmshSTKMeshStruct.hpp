@@ -44,6 +44,12 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void loadAsciiMesh (const std::string& fname);
   void loadBinaryMesh (const std::string& fname);
 
+  // Reads a $MeshFormat 2 file (ascii or binary) in parallel: every rank reads
+  // its share of the file, gets the coordinates of the nodes of its cells from
+  // the ranks that read them, and receives the sides attached to its cells.
+  void loadMeshParallel (const std::string& fname, const bool binary,
+                         const Teuchos::RCP<const Teuchos_Comm>& commT);
+
   int NumElemNodes; // Number of nodes per element (e.g. 3 for Triangles)
   int NumSideNodes; // Number of nodes per side (e.g. 2 for a Line)
   int NumNodes; //number of nodes
@@ -65,6 +71,17 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   // NOTE: do not call delete on these pointers! Delete the previous ones only!
   int** elems;
   int** sides;
+
+  // Mesh pieces of this rank if the file is read in parallel
+  bool parallelRead;
+  std::vector<GO>     localNodeIds;
+  std::vector<double> localCoords;     // 3 per node
+  std::vector<GO>     localCellIds;
+  std::vector<GO>     localCellNodes;  // NumElemNodes per cell
+  std::vector<GO>     localSideIds;
+  std::vector<int>    localSideTags;
+  std::vector<int>    localSideCells;  // index in localCellIds
+  std::vector<int>    localSideOrdinals;
 };
 
 } // Namespace Albany
@@ -24,6 +24,7 @@
 
 //#include <stk_mesh/fem/FEMHelpers.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/case_conv.hpp>
 
 #include "Albany_Utils.hpp"
 
@@ -74,15 +75,43 @@ Albany::IossSTKMeshStruct::IossSTKMeshStruct(
   mesh_data = Teuchos::rcp(new stk::io::StkMeshIoBroker(*theComm->getRawMpiComm()));
 
   // Use Greg Sjaardema's capability to repartition on the fly.
-  //    Several partitioning choices: rcb, rib, hsfc, kway, kway-gemo, linear, random
-  //          linear does not require Zoltan or metis
-  if (params->get<bool>("Use Serial Mesh", false) && commT->getSize() > 1){
-  //    Option  external  reads the nemesis files, and must be the default
+  //    Several partitioning choices (Ioss names, case insensitive): RCB, RIB, HSFC,
+  //    KWAY, GEOM_KWAY, KWAY_GEOM, METIS_SFC, LINEAR, RANDOM, BLOCK, CYCLIC
+  //          LINEAR, RANDOM, BLOCK and CYCLIC do not require Zoltan or ParMETIS
+  // Every rank reads its share of a single (not spread) Exodus file, restart
+  // fields included, so a run can restart on a different number of ranks.
+  // "Use Serial Mesh" picks a default method and rebalances afterwards.
+  std::string decompMethod = params->get<std::string>("Decomposition Method", "");
+  boost::algorithm::to_upper(decompMethod);
+  if (decompMethod.empty() && params->get<bool>("Use Serial Mesh", false)) {
 #ifdef ALBANY_ZOLTAN
-    mesh_data->property_add(Ioss::Property("DECOMPOSITION_METHOD", "rib"));
+    decompMethod = "RIB";
 #else
-    mesh_data->property_add(Ioss::Property("DECOMPOSITION_METHOD", "linear"));
+    decompMethod = "LINEAR";
+#endif
+  }
+  if (!decompMethod.empty()) {
+    const bool zoltanMethod  = decompMethod == "RCB" || decompMethod == "RIB" || decompMethod == "HSFC";
+    const bool parmetisMethod = decompMethod == "KWAY" || decompMethod == "GEOM_KWAY" ||
+                                decompMethod == "KWAY_GEOM" || decompMethod == "METIS_SFC";
+    const bool plainMethod   = decompMethod == "LINEAR" || decompMethod == "RANDOM" ||
+                               decompMethod == "BLOCK" || decompMethod == "CYCLIC";
+    TEUCHOS_TEST_FOR_EXCEPTION (!zoltanMethod && !parmetisMethod && !plainMethod,
+                                Teuchos::Exceptions::InvalidParameterValue,
+                                "Unknown Decomposition Method " << decompMethod << "; use RCB, RIB, HSFC, KWAY, "
+                                "GEOM_KWAY, KWAY_GEOM, METIS_SFC, LINEAR, RANDOM, BLOCK or CYCLIC.\n");
+#ifndef ALBANY_ZOLTAN
+    TEUCHOS_TEST_FOR_EXCEPTION (zoltanMethod, Teuchos::Exceptions::InvalidParameterValue,
+                                "Decomposition Method " << decompMethod << " requires Zoltan; use LINEAR, RANDOM, BLOCK or CYCLIC.\n");
 #endif
+#ifndef ALBANY_PARMETIS
+    TEUCHOS_TEST_FOR_EXCEPTION (parmetisMethod, Teuchos::Exceptions::InvalidParameterValue,
+                                "Decomposition Method " << decompMethod << " requires ParMETIS; use LINEAR, RANDOM, BLOCK or CYCLIC.\n");
+#endif
+  }
+  if (!decompMethod.empty() && commT->getSize() > 1){
+  //    Option  external  reads the nemesis files, and must be the default
+    mesh_data->property_add(Ioss::Property("DECOMPOSITION_METHOD", decompMethod));
   }
 
   // Create input mesh
@@ -578,6 +607,9 @@ Albany::IossSTKMeshStruct::getValidDiscretizationParameters() const
   validPL->set<std::string>("Pamgen Input File Name", "", "File Name For Pamgen Mesh Input");
   validPL->set<int>("Restart Index", 1, "Exodus time index to read for inital guess/condition.");
   validPL->set<double>("Restart Time", 1.0, "Exodus solution time to read for inital guess/condition.");
+  validPL->set<std::string>("Decomposition Method", "",
+      "Decompose a single Exodus file while reading it in parallel (Ioss method, case insensitive): RCB, RIB, HSFC (Zoltan), "
+      "KWAY, GEOM_KWAY, KWAY_GEOM, METIS_SFC (ParMETIS), LINEAR, RANDOM, BLOCK or CYCLIC");
   validPL->set<Teuchos::ParameterList>("Required Fields Info",Teuchos::ParameterList());
   validPL->set<bool>("Write points coordinates to ascii file", "", "Write the mesh points coordinates to file?");
 
@@ -11,10 +11,12 @@
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_BucketArray.hpp"
+#include "Albany_Memory.hpp"
 
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 #include <Shards_BasicTopologies.hpp>
 
@@ -35,6 +37,8 @@
 
 #ifdef ALBANY_SEACAS
 #include <Ionit_Initializer.h>
+#include <Ioss_Property.h>
+#include <stk_io/IossBridge.hpp>
 #include <netcdf.h>
 
 #ifdef ALBANY_PAR_NETCDF
@@ -74,6 +78,8 @@ STKDiscretization(
 
   out(Teuchos::VerboseObjectBase::getDefaultOStream()),
   previous_time_label(-1.0e32),
+  previous_restart_time_label(-1.0e32),
+  restartRenameCount(0),
   discParams(discParams_),
   metaData(*stkMeshStruct_->metaData),
   bulkData(*stkMeshStruct_->bulkData),
@@ -596,6 +602,38 @@ void Albany::STKDiscretization::setupMLCoords()
   writeCoordsToMatrixMarket();
 }
 
+void Albany::STKDiscretization::setupColumnLines()
+{
+  if (rigidBodyModes.is_null() || !rigidBodyModes->isColumnLinesRequested()) return;
+
+  const Teuchos::RCP<LayeredMeshNumbering<LO> > layeredNumbering =
+    stkMeshStruct->layered_mesh_numbering;
+  TEUCHOS_TEST_FOR_EXCEPTION(layeredNumbering.is_null(), std::logic_error,
+    "STKDiscretization::setupColumnLines(): the preconditioner asks for vertical lines,"
+    " but the mesh is not layered." << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(rigidBodyModes->isMueLuUsed() &&
+    layeredNumbering->ordering != LayeredMeshOrdering::COLUMN, std::logic_error,
+    "STKDiscretization::setupColumnLines(): MueLu vertical line detection requires"
+    " \"Columnwise Ordering\" = true in the Discretization list." << std::endl);
+
+  // The layered numbering is defined on overlap node lids. Renumber the
+  // columns of the owned nodes contiguously.
+  Teuchos::Array<LO> nodeLids(numOwnedNodes);
+  for (int i = 0; i < numOwnedNodes; i++)
+    nodeLids[i] = overlap_node_mapT->getLocalElement(gid(ownednodes[i]));
+  Teuchos::ArrayRCP<LO> nodeColumnIds(numOwnedNodes), nodeLevelIds(numOwnedNodes);
+  const LO numColumns = layeredNumbering->getLocalColumns(
+    nodeLids(), nodeColumnIds(), nodeLevelIds());
+
+  Teuchos::ArrayRCP<LO> dofColumnIds(numOwnedNodes*neq);
+  for (int i = 0; i < numOwnedNodes; i++)
+    for (int eq = 0; eq < neq; eq++)
+      dofColumnIds[getOwnedDOF(i, eq)] = nodeColumnIds[i];
+
+  rigidBodyModes->setColumnLines(dofColumnIds, numColumns, nodeColumnIds,
+                                 nodeLevelIds, layeredNumbering->numLevels);
+}
+
 void Albany::STKDiscretization::writeCoordsToMatrixMarket() const
 {
   //if user wants to write the coordinates to matrix market file, write them to matrix market file
@@ -800,6 +838,8 @@ writeSolutionToFileT(const Tpetra_Vector& solnT, const double time,
        *out << " to index " <<out_step<<" in file "<<stkMeshStruct->cdfOutFile<< std::endl;
      }
   }
+  if (stkMeshStruct->exoRestartOutput && !(outputInterval % stkMeshStruct->exoRestartInterval))
+    writeExodusRestartStep(time);
   outputInterval++;
 
   for (auto it : sideSetDiscretizations)
@@ -877,6 +917,8 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
        *out << " to index " <<out_step<<" in file "<<stkMeshStruct->cdfOutFile<< std::endl;
      }
   }
+  if (stkMeshStruct->exoRestartOutput && !(outputInterval % stkMeshStruct->exoRestartInterval))
+    writeExodusRestartStep(time);
   outputInterval++;
 
   for (auto it : sideSetDiscretizations)
@@ -903,28 +945,62 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
 
 double
 Albany::STKDiscretization::monotonicTimeLabel(const double time)
+{
+  return monotonicTimeLabel(time, previous_time_label);
+}
+
+double
+Albany::STKDiscretization::monotonicTimeLabel(const double time, double& previous_label)
 {
   // If increasing, then all is good
-  if (time > previous_time_label) {
-    previous_time_label = time;
+  if (time > previous_label) {
+    previous_label = time;
     return time;
   }
 // Try absolute value
   double time_label = fabs(time);
-  if (time_label > previous_time_label) {
-    previous_time_label = time_label;
+  if (time_label > previous_label) {
+    previous_label = time_label;
     return time_label;
   }
 
   // Try adding 1.0 to time
-  if (time_label+1.0 > previous_time_label) {
-    previous_time_label = time_label+1.0;
+  if (time_label+1.0 > previous_label) {
+    previous_label = time_label+1.0;
     return time_label+1.0;
   }
 
   // Otherwise, just add 1.0 to previous
-  previous_time_label += 1.0;
-  return previous_time_label;
+  previous_label += 1.0;
+  return previous_label;
+}
+
+void
+Albany::STKDiscretization::writeExodusRestartStep(const double time)
+{
+#ifdef ALBANY_SEACAS
+  // The restart file keeps its own label sequence, as it may be written at a
+  // different interval than the output file
+  const double time_label = monotonicTimeLabel(time, previous_restart_time_label);
+
+  mesh_data->begin_output_step(restartFileIdx, time_label);
+  const int out_step = mesh_data->write_defined_output_fields(restartFileIdx);
+  for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
+  {
+    mesh_data->write_global (restartFileIdx, it.first, it.second);
+  }
+  for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
+  {
+    mesh_data->write_global (restartFileIdx, it.first, it.second);
+  }
+  mesh_data->end_output_step(restartFileIdx);
+
+  if (mapT->getComm()->getRank()==0) {
+    *out << "Albany::STKDiscretization::writeSolution: writing restart time " << time;
+    if (time_label != time) *out << " with label " << time_label;
+    *out << " to index " << out_step << " in file " << stkMeshStruct->exoRestartFile << std::endl;
+  }
+#endif
 }
 
 void
@@ -2294,6 +2370,7 @@ Albany::STKDiscretization::determine_local_side_id( const stk::mesh::Entity elem
 
 void Albany::STKDiscretization::computeNodeSets()
 {
+  nodeSetDofs.clear();
 
   std::map<std::string, stk::mesh::Part*>::iterator ns = stkMeshStruct->nsPartVec.begin();
   AbstractSTKFieldContainer::VectorFieldType* coordinates_field = stkMeshStruct->getCoordinatesField();
@@ -2329,38 +2406,104 @@ void Albany::STKDiscretization::computeNodeSets()
 void Albany::STKDiscretization::setupExodusOutput()
 {
 #ifdef ALBANY_SEACAS
-  if (stkMeshStruct->exoOutput) {
+  if (stkMeshStruct->exoOutput || stkMeshStruct->exoRestartOutput) {
 
     outputInterval = 0;
 
-    std::string str = stkMeshStruct->exoOutFile;
-
     Ioss::Init::Initializer io;
 
     mesh_data = Teuchos::rcp(new stk::io::StkMeshIoBroker(Albany::getMpiCommFromTeuchosComm(commT)));
     mesh_data->set_bulk_data(bulkData);
-    outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
 
-    // Adding mesh global variables
-    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-    {
-      boost::any mvs = it.second;
-      mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::DOUBLEVECTOR);
-    }
-    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-    {
-      boost::any mvs = it.second;
-      mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
+    // Lossless compression applies to both files; it needs netCDF-4
+    if (stkMeshStruct->exoCompressionLevel > 0) {
+      mesh_data->property_add(Ioss::Property("FILE_TYPE", std::string("netcdf4")));
+      mesh_data->property_add(Ioss::Property("COMPRESSION_LEVEL", stkMeshStruct->exoCompressionLevel));
+      mesh_data->property_add(Ioss::Property("COMPRESSION_SHUFFLE", 1));
     }
 
     const stk::mesh::FieldVector &fields = mesh_data->meta_data().get_fields();
-    for (size_t i=0; i < fields.size(); i++) {
-      // Hacky, but doesn't appear to be a way to query if a field is already
-      // going to be output.
-      try {
-        mesh_data->add_field(outputFileIdx, *fields[i]);
+
+    if (stkMeshStruct->exoOutput) {
+      std::string str = stkMeshStruct->exoOutFile;
+
+      if (stkMeshStruct->exoSinglePrecision)
+        mesh_data->property_add(Ioss::Property("REAL_SIZE_DB", 4));
+      outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
+      mesh_data->remove_property_if_exists("REAL_SIZE_DB");
+
+      // Only write the requested element blocks
+      const std::vector<std::string>& blocks = stkMeshStruct->exoOutputBlocks;
+      if (!blocks.empty()) {
+        Teuchos::RCP<stk::mesh::Selector> selector = Teuchos::rcp(new stk::mesh::Selector);
+        for (size_t i=0; i < blocks.size(); i++) {
+          stk::mesh::Part* part = mesh_data->meta_data().get_part(blocks[i]);
+          TEUCHOS_TEST_FOR_EXCEPTION(part == NULL, std::logic_error,
+              "Error! Exodus Output Element Blocks: unknown block " << blocks[i] << ".\n");
+          *selector |= *part;
+        }
+        mesh_data->set_subset_selector(outputFileIdx, selector);
+      }
+
+      // Adding mesh global variables
+      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
+      {
+        boost::any mvs = it.second;
+        mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::DOUBLEVECTOR);
+      }
+      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
+      {
+        boost::any mvs = it.second;
+        mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
+      }
+
+      const std::vector<std::string>& names = stkMeshStruct->exoOutputFields;
+      for (size_t i=0; i < fields.size(); i++) {
+        if (!names.empty() &&
+            std::find(names.begin(), names.end(), fields[i]->name()) == names.end())
+          continue;
+        // Hacky, but doesn't appear to be a way to query if a field is already
+        // going to be output.
+        try {
+          mesh_data->add_field(outputFileIdx, *fields[i]);
+        }
+        catch (std::runtime_error const&) { }
+      }
+    }
+
+    // The restart file keeps the whole mesh in double precision, but only the
+    // nodal fields (solution and its time derivatives) and the Restart Fields
+    if (stkMeshStruct->exoRestartOutput) {
+      // A composed file can be read back on a different number of ranks
+      // (see "Decomposition Method")
+      if (stkMeshStruct->exoRestartSingleFile)
+        mesh_data->property_add(Ioss::Property("COMPOSE_RESTART", 1));
+      restartFileIdx = mesh_data->create_output_mesh(stkMeshStruct->exoRestartFile, stk::io::WRITE_RESTART);
+      mesh_data->remove_property_if_exists("COMPOSE_RESTART");
+
+      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
+      {
+        boost::any mvs = it.second;
+        mesh_data->add_global (restartFileIdx, it.first, mvs, stk::util::ParameterType::DOUBLEVECTOR);
+      }
+      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
+      {
+        boost::any mvs = it.second;
+        mesh_data->add_global (restartFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
+      }
+
+      const std::vector<std::string>& names = stkMeshStruct->exoRestartFields;
+      for (size_t i=0; i < fields.size(); i++) {
+        const Ioss::Field::RoleType* role = stk::io::get_field_role(*fields[i]);
+        const bool nodal = fields[i]->entity_rank() == stk::topology::NODE_RANK &&
+                           role != NULL && *role == Ioss::Field::TRANSIENT;
+        if (!nodal && std::find(names.begin(), names.end(), fields[i]->name()) == names.end())
+          continue;
+        try {
+          mesh_data->add_field(restartFileIdx, *fields[i]);
+        }
+        catch (std::runtime_error const&) { }
       }
-      catch (std::runtime_error const&) { }
     }
   }
 #else
@@ -2839,14 +2982,32 @@ void Albany::STKDiscretization::setupNetCDFOutput()
 void Albany::STKDiscretization::reNameExodusOutput(std::string& filename)
 {
 #ifdef ALBANY_SEACAS
-  if (stkMeshStruct->exoOutput && !mesh_data.is_null()) {
+  if ((stkMeshStruct->exoOutput || stkMeshStruct->exoRestartOutput) && !mesh_data.is_null()) {
     // Delete the mesh data object and recreate it
     mesh_data = Teuchos::null;
 
-    stkMeshStruct->exoOutFile = filename;
+    if (stkMeshStruct->exoOutput) {
+      stkMeshStruct->exoOutFile = filename;
+
+      // reset reference value for monotonic time function call as we are writing to a new file
+      previous_time_label = -1.0e32;
+    }
+
+    // The restart file of the adapted mesh follows the naming of the output
+    // file: the rename count is added ahead of the first period
+    if (stkMeshStruct->exoRestartOutput) {
+      if (restartBaseFile.empty())
+        restartBaseFile = stkMeshStruct->exoRestartFile;
 
-    // reset reference value for monotonic time function call as we are writing to a new file
-    previous_time_label = -1.0e32;
+      std::ostringstream ss;
+      ss << "_" << ++restartRenameCount;
+      std::string str = restartBaseFile;
+      const std::size_t dot = str.find('.');
+      str.insert(dot == std::string::npos ? str.size() : dot, ss.str());
+      stkMeshStruct->exoRestartFile = str;
+
+      previous_restart_time_label = -1.0e32;
+    }
   }
 #else
   if (stkMeshStruct->exoOutput)
@@ -3141,6 +3302,8 @@ Albany::STKDiscretization::updateMesh()
 
   computeOverlapNodesAndUnknowns();
 
+  setupColumnLines();
+
   transformMesh();
 
   computeGraphs();
@@ -3183,4 +3346,32 @@ Albany::STKDiscretization::updateMesh()
 
     buildSideSetProjectors();
   }
+
+  MemoryTracker& mt = MemoryTracker::instance();
+  if (mt.isEnabled()) {
+    mt.setComponentBytes("STK Fields", fieldBytes());
+    double bytes = 0;
+    for (int ws = 0; ws < wsElNodeEqID.size(); ++ws)
+      bytes += wsElNodeEqID[ws].size()*sizeof(LO);
+    for (int ws = 0; ws < wsElNodeID.size(); ++ws)
+      for (int cell = 0; cell < wsElNodeID[ws].size(); ++cell)
+        bytes += wsElNodeID[ws][cell].size()*sizeof(GO);
+    mt.setComponentBytes("Workset Connectivity", bytes);
+  }
+}
+
+double Albany::STKDiscretization::fieldBytes() const
+{
+  double bytes = 0;
+  const stk::mesh::FieldVector& fields = metaData.get_fields();
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    const stk::mesh::BucketVector& buckets =
+      bulkData.buckets(fields[f]->entity_rank());
+    for (std::size_t b = 0; b < buckets.size(); ++b)
+      bytes += static_cast<double>(buckets[b]->size())*
+        stk::mesh::field_bytes_per_entity(*fields[f], *buckets[b]);
+  }
+  for (const auto& it : sideSetDiscretizationsSTK)
+    bytes += it.second->fieldBytes();
+  return bytes;
 }
@@ -155,6 +155,9 @@ namespace Albany {
     const NodeSetList& getNodeSets() const { return nodeSets; };
     const NodeSetGIDsList& getNodeSetGIDs() const { return nodeSetGIDs; };
     const NodeSetCoordList& getNodeSetCoords() const { return nodeSetCoords; };
+    const std::vector<LO>& getNodeSetDofs(const std::string& name, const int offset) const {
+      return nodeSetDofs.get(nodeSets, name, offset);
+    }
 
     //! Get Side set lists (typedef in Albany_AbstractDiscretization.hpp)
     const SideSetList& getSideSets(const int workset) const { return sideSets[workset]; };
@@ -360,6 +363,10 @@ namespace Albany {
     void setOvlpSolutionFieldMV(const Tpetra_MultiVector& solnT);
 
     double monotonicTimeLabel(const double time);
+    double monotonicTimeLabel(const double time, double& previous_label);
+
+    //! Write the current step to the Exodus restart file
+    void writeExodusRestartStep(const double time);
 
     void computeNodalMaps(bool overlapped);
 
@@ -369,6 +376,8 @@ namespace Albany {
     void computeOwnedNodesAndUnknowns();
     //! Process coords for ML
     void setupMLCoords();
+    //! Pass the vertical columns of a layered mesh to the preconditioner
+    void setupColumnLines();
     //! Process STK mesh for Overlap nodal quantitites
     void computeOverlapNodesAndUnknowns();
     //! Process STK mesh for Workset/Bucket Info
@@ -394,9 +403,18 @@ namespace Albany {
 
     void writeCoordsToMatrixMarket() const;
 
+    //! Bytes held by the STK fields of this mesh and of its side set meshes
+    double fieldBytes() const;
+
     void buildSideSetProjectors ();
 
     double previous_time_label;
+    double previous_restart_time_label;
+
+    //! Restart file name given in the input, and how many times the restart
+    //! file was renamed after a mesh adaptation
+    std::string restartBaseFile;
+    int restartRenameCount;
 
   protected:
 
@@ -462,6 +480,7 @@ namespace Albany {
     Albany::NodeSetList nodeSets;
     Albany::NodeSetGIDsList nodeSetGIDs;
     Albany::NodeSetCoordList nodeSetCoords;
+    Albany::NodeSetDofs nodeSetDofs;
 
     //! side sets stored as std::map(string ID, SideArray classes) per workset (std::vector across worksets)
     std::vector<Albany::SideSetList> sideSets;
@@ -537,6 +556,7 @@ namespace Albany {
     int outputInterval;
 
     size_t outputFileIdx;
+    size_t restartFileIdx;
 #endif
     bool interleavedOrdering;
 
@@ -8,64 +8,113 @@
 #include <stk_util/parallel/CommSparse.hpp>
 #include "Teuchos_TimeMonitor.hpp"
 
+#include <map>
+#include <vector>
+
 //----------------------------------------------------------------------
 
 // AGS 03/2015: This is code from STK that was deprecated, so I moved it here
 //              as part of Albany.
+//
+// Every node is sent to a rendezvous process chosen by its id. The rendezvous
+// process learns all the processes holding the node and sends each of them
+// the others, so the communication is proportional to the number of local
+// nodes rather than to the number of local nodes times the number of
+// processes.
 
 void Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data) {
 
     TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: fix_node_sharing");
 
+    const int num_procs = bulk_data.parallel_size();
+    if (num_procs == 1) return;
+
+    std::vector<stk::mesh::EntityKey> keys;
+    const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
+    for (size_t j=0;j<buckets.size();++j)
+    {
+        const stk::mesh::Bucket& bucket = *buckets[j];
+        if ( bucket.owned() )
+        {
+            for (size_t k=0;k<bucket.size();++k)
+                keys.push_back(bulk_data.entity_key(bucket[k]));
+        }
+    }
+
+    // Send the nodes to their rendezvous processes
     stk::CommSparse comm(bulk_data.parallel());
+    for (int phase=0;phase<2;++phase)
+    {
+        for (size_t i=0;i<keys.size();++i)
+        {
+            const int rendezvous = keys[i].id() % num_procs;
+            comm.send_buffer(rendezvous).pack<stk::mesh::EntityKey>(keys[i]);
+        }
 
+        if (phase == 0 )
+        {
+            comm.allocate_buffers();
+        }
+        else
+        {
+            comm.communicate();
+        }
+    }
+
+    std::map<stk::mesh::EntityKey, std::vector<int> > holders;
+    for (int i=0;i<num_procs;++i)
+    {
+        while(comm.recv_buffer(i).remaining())
+        {
+            stk::mesh::EntityKey key;
+            comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+            holders[key].push_back(i);
+        }
+    }
+
+    // Tell every holder of a node about the other holders
+    stk::CommSparse reply(bulk_data.parallel());
     for (int phase=0;phase<2;++phase)
     {
-        for (int i=0;i<bulk_data.parallel_size();++i)
+        std::map<stk::mesh::EntityKey, std::vector<int> >::const_iterator it;
+        for (it=holders.begin();it!=holders.end();++it)
         {
-            if ( i != bulk_data.parallel_rank() )
+            const std::vector<int>& procs = it->second;
+            if (procs.size() < 2) continue;
+            for (size_t p=0;p<procs.size();++p)
             {
-                const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
-                for (size_t j=0;j<buckets.size();++j)
+                for (size_t q=0;q<procs.size();++q)
                 {
-                    const stk::mesh::Bucket& bucket = *buckets[j];
-                    if ( bucket.owned() )
-                    {
-                        for (size_t k=0;k<bucket.size();++k)
-                        {
-                            stk::mesh::EntityKey key = bulk_data.entity_key(bucket[k]);
-                            comm.send_buffer(i).pack<stk::mesh::EntityKey>(key);
-                        }
-                    }
+                    if (q == p) continue;
+                    reply.send_buffer(procs[p]).pack<stk::mesh::EntityKey>(it->first);
+                    reply.send_buffer(procs[p]).pack<int>(procs[q]);
                 }
             }
         }
 
         if (phase == 0 )
         {
-            comm.allocate_buffers();
+            reply.allocate_buffers();
         }
         else
         {
-            comm.communicate();
+            reply.communicate();
         }
     }
 
-    for (int i=0;i<bulk_data.parallel_size();++i)
+    for (int i=0;i<num_procs;++i)
     {
-        if ( i != bulk_data.parallel_rank() )
+        while(reply.recv_buffer(i).remaining())
         {
-            while(comm.recv_buffer(i).remaining())
+            stk::mesh::EntityKey key;
+            int proc;
+            reply.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+            reply.recv_buffer(i).unpack<int>(proc);
+            stk::mesh::Entity node = bulk_data.get_entity(key);
+            if ( bulk_data.is_valid(node) )
             {
-                stk::mesh::EntityKey key;
-                comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
-                stk::mesh::Entity node = bulk_data.get_entity(key);
-                if ( bulk_data.is_valid(node) )
-                {
-                    bulk_data.add_node_sharing(node, i);
-                }
+                bulk_data.add_node_sharing(node, proc);
             }
         }
     }
 }
-
@@ -49,9 +49,27 @@ private:
 
   std::size_t numNodes;
   std::size_t numQPs;
+
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct DOFInterpolationBase_Residual_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, DOFInterpolationBase_Residual_Tag> DOFInterpolationBase_Residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFInterpolationBase_Residual_Tag& tag, const int& cell) const;
+#endif
 };
-/*
+
 //! Specialization for Jacobian evaluation taking advantage of known sparsity
+/*!
+  This evaluator is also used for nodal fields that are not solution dofs,
+  whose derivatives are not sparse.  The sparse contraction is therefore
+  used only for the cells where the derivatives of all the nodal values
+  live in the slots seeded by the gather, neq*node+offset, and only if
+  "Offset of First DOF" is given.
+*/
 template<typename Traits>
 class DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
       : public PHX::EvaluatorWithBaseImpl<Traits>,
@@ -83,9 +101,27 @@ private:
 
   std::size_t numNodes;
   std::size_t numQPs;
-  std::size_t offset;
+  int offset;
+
+  int num_dof, neq;
+
+  KOKKOS_INLINE_FUNCTION
+  bool hasGatherSparsity (const int cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void interpolateCell (const int cell) const;
+
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct DOFInterpolationBase_Jacobian_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, DOFInterpolationBase_Jacobian_Tag> DOFInterpolationBase_Jacobian_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFInterpolationBase_Jacobian_Tag& tag, const int& cell) const;
+#endif
 };
-*/
 #ifdef ALBANY_SG
 //! Specialization for SGJacobian evaluation taking advantage of known sparsity
 template<typename Traits>
@@ -44,6 +44,23 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(val_qp,fm);
 }
 
+//**********************************************************************
+// Kokkos kernel for Residual
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+template<typename EvalT, typename Traits, typename ScalarT>
+KOKKOS_INLINE_FUNCTION
+void DOFInterpolationBase<EvalT, Traits, ScalarT>::
+operator() (const DOFInterpolationBase_Residual_Tag& tag, const int& cell) const
+{
+  for (int qp=0; qp < numQPs; ++qp) {
+    val_qp(cell,qp) = val_node(cell, 0) * BF(cell, 0, qp);
+    for (int node=1; node < numNodes; ++node) {
+      val_qp(cell,qp) += val_node(cell, node) * BF(cell, node, qp);
+    }
+  }
+}
+#endif
+
 //**********************************************************************
 template<typename EvalT, typename Traits, typename ScalarT>
 void DOFInterpolationBase<EvalT, Traits, ScalarT>::
@@ -53,6 +70,7 @@ evaluateFields(typename Traits::EvalData workset)
   // for (int i=0; i < val_qp.size() ; i++) val_qp[i] = 0.0;
   // Intrepid2::FunctionSpaceTools:: evaluate<ScalarT>(val_qp, val_node, BF);
 
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
       //ScalarT& vqp = val_qp(cell,qp);
@@ -62,9 +80,11 @@ evaluateFields(typename Traits::EvalData workset)
       }
     }
   }
+#else
+  Kokkos::parallel_for(DOFInterpolationBase_Residual_Policy(0,workset.numCells),*this);
+#endif
 }
 
-#if 0 // This whole block is commented out
 //**********************************************************************
 template<typename Traits>
 DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
@@ -85,7 +105,8 @@ DOFInterpolationBase(const Teuchos::ParameterList& p,
   numNodes = dims[1];
   numQPs   = dims[2];
 
-  offset = p.get<int>("Offset of First DOF");
+  // A negative offset disables the sparse contraction
+  offset = p.isParameter("Offset of First DOF") ? p.get<int>("Offset of First DOF") : -1;
 }
 
 //**********************************************************************
@@ -101,34 +122,82 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 //**********************************************************************
 template<typename Traits>
-void DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
-evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION
+bool DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+hasGatherSparsity (const int cell) const
 {
-  //Intrepid2 version:
-  // for (int i=0; i < val_qp.size() ; i++) val_qp[i] = 0.0;
-  // Intrepid2::FunctionSpaceTools:: evaluate<ScalarT>(val_qp, val_node, BF);
-
-  const int num_dof = val_node(0,0).size();
-  const int neq = workset.wsElNodeEqID.dimension(2);
-std::cout << val_node.fieldTag().name() << ", ws " << workset.wsIndex << ":\n";
+  // Without derivatives there is no slot to write to
+  if (offset < 0 || num_dof == 0) return false;
+  for (int node=0; node < numNodes; ++node) {
+    const ScalarT& v = val_node(cell, node);
+    if (v.size() != num_dof) return false;
+    const int slot = neq*node+offset;
+    if (slot >= num_dof) return false;
+    for (int k=0; k < num_dof; ++k)
+      if (k != slot && v.fastAccessDx(k) != 0.0) return false;
+  }
+  return true;
+}
 
-  for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-    for (std::size_t qp=0; qp < numQPs; ++qp) {
-      //ScalarT& vqp = val_qp(cell,qp);
-      val_qp(cell,qp) = ScalarT(num_dof, val_node(cell, 0).val() * BF(cell, 0, qp));
-      if (num_dof) (val_qp(cell,qp)).fastAccessDx(offset) = val_node(cell, 0).fastAccessDx(offset) * BF(cell, 0, qp);
-std::cout << "  val_node(" << cell << "," << 0 << ") = " << val_node(cell,0) << "\n";
-      for (std::size_t node=1; node < numNodes; ++node) {
-        (val_qp(cell,qp)).val() += val_node(cell, node).val() * BF(cell, node, qp);
-        if (num_dof) (val_qp(cell,qp)).fastAccessDx(neq*node+offset) += val_node(cell, node).fastAccessDx(neq*node+offset) * BF(cell, node, qp);
-std::cout << "  val_node(" << cell << "," << node << ") = " << val_node(cell,node) << "\n";
+//**********************************************************************
+template<typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+interpolateCell (const int cell) const
+{
+  if (hasGatherSparsity(cell)) {
+    // Node i only contributes to derivative slot neq*i+offset: one
+    // multiply-add per node instead of num_dof.
+    for (int qp=0; qp < numQPs; ++qp) {
+      ScalarT& vqp = val_qp(cell,qp);
+      vqp = ScalarT(num_dof, 0.0);
+      for (int node=0; node < numNodes; ++node) {
+        const int slot = neq*node+offset;
+        vqp.val() += val_node(cell, node).val() * BF(cell, node, qp);
+        vqp.fastAccessDx(slot) += val_node(cell, node).fastAccessDx(slot) * BF(cell, node, qp);
+      }
+    }
+  }
+  else {
+    for (int qp=0; qp < numQPs; ++qp) {
+      val_qp(cell,qp) = val_node(cell, 0) * BF(cell, 0, qp);
+      for (int node=1; node < numNodes; ++node) {
+        val_qp(cell,qp) += val_node(cell, node) * BF(cell, node, qp);
       }
-std::cout << "  val_qp(" << cell << "," << qp << ") = " << val_qp(cell,qp) << "\n";
     }
   }
 }
+
+//**********************************************************************
+// Kokkos kernel for Jacobian
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+template<typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+operator() (const DOFInterpolationBase_Jacobian_Tag& tag, const int& cell) const
+{
+  interpolateCell(cell);
+}
 #endif
 
+//**********************************************************************
+template<typename Traits>
+void DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  if (workset.numCells == 0) return;
+
+  num_dof = val_node(0,0).size();
+  neq = workset.wsElNodeEqID.dimension(2);
+
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (std::size_t cell=0; cell < workset.numCells; ++cell)
+    interpolateCell(cell);
+#else
+  Kokkos::parallel_for(DOFInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
+#endif
+}
+
 #ifdef ALBANY_SG
 //**********************************************************************
 template<typename Traits>
@@ -60,9 +60,15 @@ public:
   virtual ScalarT& getValue(const std::string &n) { return value; }
 
 protected:
+  //! Sorted local ids of the DOFs set by this BC on the workset's node set
+  const std::vector<LO>& getNodeSetDofs(typename Traits::EvalData d);
+
   const int offset;
   ScalarT value;
   std::string nodeSetID;
+
+private:
+  std::vector<LO> nodeSetDofs;
 };
 
 // **************************************************************
@@ -10,6 +10,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Tpetra_CrsMatrix.hpp"
+#include "PHAL_Utilities.hpp"
 
 
 // **********************************************************************
@@ -96,12 +97,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
   const std::vector<double*>& nsNodeCoords =
     dirichletWorkset.nodeSetCoords->find(this->nodeSetID)->second;
 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1); 
-  size_t numEntriesT;  
-  value[0] = j_coeff; 
   Teuchos::Array<ST> matrixEntriesT; 
-  Teuchos::Array<LO> matrixIndicesT; 
 
   bool fillResid = (fT != Teuchos::null);
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
@@ -120,16 +116,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
     for(unsigned int j = 0; j < number_of_components; j++) {
 
       int offset = nsNodes[inode][j];
-      index[0] = offset; 
-      numEntriesT = jacT->getNumEntriesInLocalRow(offset);
-      matrixEntriesT.resize(numEntriesT); 
-      matrixIndicesT.resize(numEntriesT); 
-
-      jacT->getLocalRowCopy(offset, matrixIndicesT(), matrixEntriesT(), numEntriesT); 
-      for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-      jacT->replaceLocalValues(offset, matrixIndicesT(), matrixEntriesT()); 
-
-      jacT->replaceLocalValues(offset, index(), value()); 
+      PHAL::setDirichletRowT(*jacT, offset, j_coeff, matrixEntriesT);
 
       if(fillResid) {
         fT_nonconstView[offset] = (xT_constView[offset] - BCVals[j].val());
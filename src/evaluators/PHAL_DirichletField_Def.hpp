@@ -10,6 +10,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Tpetra_CrsMatrix.hpp"
+#include "PHAL_Utilities.hpp"
 
 // **********************************************************************
 // Genereric Template Code for Constructor and PostRegistrationSetup
@@ -98,25 +99,11 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
   Teuchos::ArrayRCP<ST> fT_nonconstView;                                         
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1); 
-  size_t numEntriesT;  
-  value[0] = j_coeff; 
   Teuchos::Array<ST> matrixEntriesT; 
-  Teuchos::Array<LO> matrixIndicesT; 
 
   for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
       int lunk = nsNodes[inode][this->offset];
-      index[0] = lunk; 
-      numEntriesT = jacT->getNumEntriesInLocalRow(lunk);
-      matrixEntriesT.resize(numEntriesT); 
-      matrixIndicesT.resize(numEntriesT); 
-
-      jacT->getLocalRowCopy(lunk, matrixIndicesT(), matrixEntriesT(), numEntriesT); 
-      for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-      jacT->replaceLocalValues(lunk, matrixIndicesT(), matrixEntriesT()); 
-
-      jacT->replaceLocalValues(lunk, index(), value()); 
+      PHAL::setDirichletRowT(*jacT, lunk, j_coeff, matrixEntriesT);
       
       if (fillResid) {
         GO node_gid = nsNodesGIDs[inode];
@@ -10,6 +10,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Tpetra_CrsMatrix.hpp"
+#include "PHAL_Utilities.hpp"
 
 // **********************************************************************
 // Genereric Template Code for Constructor and PostRegistrationSetup
@@ -98,12 +99,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   if (fillResid)
     fT_nonconstView = fT->get1dViewNonConst();
 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1);
-  size_t numEntriesT;
-  value[0] = j_coeff;
   Teuchos::Array<ST> matrixEntriesT;
-  Teuchos::Array<LO> matrixIndicesT;
 
   // Loop on all local dofs and set the BC on those not in nodeSetsRows
   LO num_local_dofs = jacT->getRangeMap()->getNodeNumElements();
@@ -112,19 +108,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
     if (nodeSetsRows.find(row)==nodeSetsRows.end())
     {
       // It's a row not on the given node sets
-      index[0] = row;
-
-      numEntriesT = jacT->getNumEntriesInLocalRow(row);
-      matrixEntriesT.resize(numEntriesT);
-      matrixIndicesT.resize(numEntriesT);
-
-      jacT->getLocalRowCopy(row, matrixIndicesT(), matrixEntriesT(), numEntriesT);
-
-      for (int i=0; i<numEntriesT; i++)
-        matrixEntriesT[i]=0;
-
-      jacT->replaceLocalValues(row, matrixIndicesT(), matrixEntriesT());
-      jacT->replaceLocalValues(row, index(), value());
+      PHAL::setDirichletRowT(*jacT, row, j_coeff, matrixEntriesT);
 
       if (fillResid)
         fT_nonconstView[row] = xT_constView[row] - this->value.val();
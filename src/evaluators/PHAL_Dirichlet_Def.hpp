@@ -61,6 +61,24 @@ postRegistrationSetup(typename Traits::SetupData d,
 {
 }
 
+template<typename EvalT, typename Traits>
+const std::vector<LO>& DirichletBase<EvalT, Traits>::
+getNodeSetDofs(typename Traits::EvalData dirichletWorkset)
+{
+  // The discretization caches the flattened DOFs of its own node sets until
+  // they change; node sets from elsewhere are flattened here.
+  if (Teuchos::nonnull(dirichletWorkset.disc) &&
+      &dirichletWorkset.disc->getNodeSets() == dirichletWorkset.nodeSets.get())
+    return dirichletWorkset.disc->getNodeSetDofs(this->nodeSetID, this->offset);
+
+  const std::vector<std::vector<int> >& nsNodes =
+    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  nodeSetDofs.resize(nsNodes.size());
+  for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
+    nodeSetDofs[inode] = nsNodes[inode][this->offset];
+  return nodeSetDofs;
+}
+
 // **********************************************************************
 // Specialization: Residual
 // **********************************************************************
@@ -82,11 +100,11 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
 
-  // Grab the vector off node GIDs for this Node Set ID from the std::map
-  const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  // Grab the local DOFs for this Node Set ID
+  const std::vector<LO>& dofs = this->getNodeSetDofs(dirichletWorkset);
 
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
+  for (unsigned int i = 0; i < dofs.size(); i++) {
+      const LO lunk = dofs[i];
       // (*f)[lunk] = ((*x)[lunk] - this->value);
       fT_nonconstView[lunk] = xT_constView[lunk] - this->value;
 #if defined(ALBANY_LCM)
@@ -119,33 +137,23 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
-  const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  const std::vector<LO>& dofs = this->getNodeSetDofs(dirichletWorkset);
 
   bool fillResid = (fT != Teuchos::null);
   Teuchos::ArrayRCP<ST> fT_nonconstView;
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
-  Teuchos::Array<LO> index(1);
-  Teuchos::Array<ST> value(1);
-  size_t numEntriesT;
-  value[0] = j_coeff;
   Teuchos::Array<ST> matrixEntriesT;
-  Teuchos::Array<LO> matrixIndicesT;
-
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
-      index[0] = lunk;
-      numEntriesT = jacT->getNumEntriesInLocalRow(lunk);
-      matrixEntriesT.resize(numEntriesT);
-      matrixIndicesT.resize(numEntriesT);
-
-      jacT->getLocalRowCopy(lunk, matrixIndicesT(), matrixEntriesT(), numEntriesT);
-      for (int i=0; i<numEntriesT; i++) matrixEntriesT[i]=0;
-      jacT->replaceLocalValues(lunk, matrixIndicesT(), matrixEntriesT());
 
-      jacT->replaceLocalValues(lunk, index(), value());
+  for (unsigned int i = 0; i < dofs.size(); i++) {
+      const LO lunk = dofs[i];
+      PHAL::setDirichletRowT(*jacT, lunk, j_coeff, matrixEntriesT);
 
       if (fillResid) fT_nonconstView[lunk] = xT_constView[lunk] - this->value.val();
+#if defined(ALBANY_LCM)
+      // Record DOFs to avoid setting Schwarz BCs on them.
+      dirichletWorkset.fixed_dofs_.insert(lunk);
+#endif
   }
 }
 
@@ -178,11 +186,10 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
-  const std::vector<std::vector<int> >& nsNodes =
-    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  const std::vector<LO>& dofs = this->getNodeSetDofs(dirichletWorkset);
 
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-    int lunk = nsNodes[inode][this->offset];
+  for (unsigned int inode = 0; inode < dofs.size(); inode++) {
+    const LO lunk = dofs[inode];
 
     if (fT != Teuchos::null) {
       fT_nonconstView[lunk] = xT_constView[lunk] - this->value.val();
@@ -229,16 +236,15 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   bool trans = dirichletWorkset.transpose_dist_param_deriv;
   int num_cols = fpVT->getNumVectors();
 
-  const std::vector<std::vector<int> >& nsNodes =
-    dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  const std::vector<LO>& dofs = this->getNodeSetDofs(dirichletWorkset);
 
   // For (df/dp)^T*V we zero out corresponding entries in V
   if (trans) {
     Teuchos::RCP<Tpetra_MultiVector> VpT = dirichletWorkset.Vp_bcT;
     //non-const view of VpT
     Teuchos::ArrayRCP<ST> VpT_nonconstView;
-    for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
+    for (unsigned int inode = 0; inode < dofs.size(); inode++) {
+      const LO lunk = dofs[inode];
 
       for (int col=0; col<num_cols; ++col) {
         //(*Vp)[col][lunk] = 0.0;
@@ -250,8 +256,8 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 
   // for (df/dp)*V we zero out corresponding entries in df/dp
   else {
-    for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
+    for (unsigned int inode = 0; inode < dofs.size(); inode++) {
+      const LO lunk = dofs[inode];
 
       for (int col=0; col<num_cols; ++col) {
         //(*fpV)[col][lunk] = 0.0;
@@ -499,6 +499,11 @@ evaluateFields(typename Traits::EvalData workset)
   int numDims = 0;
   if (this->tensorRank==2) numDims = this->valTensor.dimension(2);
 
+  // Rows replaced by Dirichlet conditions after the fill are left out (in the
+  // adjoint they are columns, so everything is assembled)
+  const DofMask* dirichletRows =
+    workset.is_adjoint ? NULL : workset.dirichletRows.get();
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
@@ -508,11 +513,12 @@ evaluateFields(typename Traits::EvalData workset)
     }
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
+        const LO rowT = nodeID(cell,node,this->offset + eq);
+        if (dirichletRows != NULL && dirichletRows->contains(rowT)) continue;
         typename PHAL::Ref<ScalarT const>::type
           valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor(cell,node, eq/numDims, eq%numDims));
-        const LO rowT = nodeID(cell,node,this->offset + eq);
         if (loadResid)
           fT->sumIntoLocalValue(rowT, valptr.val());
         // Check derivative array is nonzero
@@ -152,11 +152,14 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->sublist("Neumann BCs", false, "");
   validPL->sublist("Adaptation", false, "");
   validPL->sublist("Catalyst", false, "");
+  validPL->sublist("In Situ Analysis", false, "");
   validPL->set<bool>("Solve Adjoint", false, "");
   validPL->set<int>("Number Of Time Derivatives", 1, "Number of time derivatives in use in the problem");
 
   validPL->set<bool>("Ignore Residual In Jacobian", false,
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
+  validPL->set<bool>("Linear Problem", false,
+                     "The Jacobian does not depend on the solution or time: assemble the stiffness and mass matrices once and reuse them");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
 
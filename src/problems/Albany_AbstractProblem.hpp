@@ -9,6 +9,7 @@
 #ifndef ALBANY_ABSTRACTPROBLEM_HPP
 #define ALBANY_ABSTRACTPROBLEM_HPP
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -128,6 +129,13 @@ class AbstractProblem {
     return offsets_;
   }
 
+  //! Offsets of the DBCs of each node set whose rows the Dirichlet field
+  //! manager replaces entirely (see BCUtils::getDirichletRowOffsets)
+  const std::map<std::string, std::vector<int>>&
+  getDirichletRowOffsets() const {
+    return dirichletRowOffsets_;
+  }
+
   //! Return the Null space object used to communicate with MP
   const Teuchos::RCP<Albany::RigidBodyModes>&
   getNullSpace() {
@@ -161,6 +169,16 @@ class AbstractProblem {
     return ss_requirements;
   }
 
+  //! Whether the residual is affine in x, xdot and xdotdot, with a Jacobian
+  //! independent of the solution and of time. The Application then assembles
+  //! the stiffness and mass matrices once and forms the Jacobian from them.
+  //! Defaults to the "Linear Problem" flag; problems that are always linear
+  //! may override it.
+  virtual bool
+  isLinear() const {
+    return params->get("Linear Problem", false);
+  }
+
   //! Allow the Problem to modify the solver settings, for example by adding a
   //! custom status test.
   virtual void
@@ -169,6 +187,7 @@ class AbstractProblem {
 
  protected:
   Teuchos::Array<Teuchos::Array<int>> offsets_;
+  std::map<std::string, std::vector<int>> dirichletRowOffsets_;
   //! List of valid problem params common to all problems, as
   //! a starting point for the specific  getValidProblemParameters
   Teuchos::RCP<Teuchos::ParameterList>
@@ -84,6 +84,7 @@ Albany::AdvDiffProblem::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 Teuchos::RCP<const Teuchos::ParameterList>
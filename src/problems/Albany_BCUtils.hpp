@@ -7,6 +7,7 @@
 #ifndef ALBANY_BCUTILS_HPP
 #define ALBANY_BCUTILS_HPP
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -182,6 +183,13 @@ class BCUtils {
     return offsets_;
   }
 
+  //! Offsets of the constant DBCs of each node set. Their Jacobian and
+  //! residual rows are replaced entirely by the Dirichlet field manager.
+  std::map<std::string, std::vector<int>>
+  getDirichletRowOffsets() const {
+    return dirichletRowOffsets_;
+  }
+
   bool useSDBCs() const { return use_sdbcs_; }
 
   //! Specific implementation for Dirichlet BC Evaluator below
@@ -258,6 +266,7 @@ class BCUtils {
 
  protected:
    Teuchos::Array<Teuchos::Array<int>> offsets_;
+   std::map<std::string, std::vector<int>> dirichletRowOffsets_;
    bool use_sdbcs_{false};
 };
 
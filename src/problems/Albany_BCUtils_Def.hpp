@@ -327,6 +327,7 @@ Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList(
   RCP<std::vector<string>> bcs = rcp(new std::vector<string>());
 
   offsets_.resize(nodeSetIDs.size());
+  dirichletRowOffsets_.clear();
   // Check for all possible standard BCs (every dof on every nodeset) to see
   // which is set
 
@@ -344,6 +345,7 @@ Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList(
         // p->set< int >     ("Number of Equations", dirichletNames.size());
         p->set<int>("Equation Offset", j);
         offsets_[i].push_back(j);
+        dirichletRowOffsets_[nodeSetIDs[i]].push_back(j);
         p->set<RCP<ParamLib>>("Parameter Library", paramLib);
 
         evaluators_to_build[evaluatorsToBuildName(ss)] = p;
@@ -77,6 +77,7 @@ Albany::CahnHillProblem::constructDirichletEvaluators(const std::vector<std::str
    dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
                                           this->params, this->paramLib);
   offsets_ = bcUtils.getOffsets(); 
+  dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 Teuchos::RCP<const Teuchos::ParameterList>
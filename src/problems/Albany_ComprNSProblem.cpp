@@ -83,6 +83,7 @@ Albany::ComprNSProblem::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
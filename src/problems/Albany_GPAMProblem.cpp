@@ -80,6 +80,7 @@ Albany::GPAMProblem::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(meshSpecs.nsNames, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 Teuchos::RCP<const Teuchos::ParameterList>
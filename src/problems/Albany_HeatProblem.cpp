@@ -122,6 +122,7 @@ Albany::HeatProblem::constructDirichletEvaluators(const std::vector<std::string>
    dfm = bcUtils.constructBCEvaluators(nodeSetIDs, bcNames,
                                           this->params, this->paramLib);
   offsets_ = bcUtils.getOffsets(); 
+  dirichletRowOffsets_ = bcUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
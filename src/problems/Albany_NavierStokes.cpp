@@ -179,6 +179,7 @@ Albany::NavierStokes::constructDirichletEvaluators(
    dfm = dirUtils.constructBCEvaluators(nodeSetIDs, dirichletNames,
                                           this->params, this->paramLib);
    offsets_ = dirUtils.getOffsets(); 
+   dirichletRowOffsets_ = dirUtils.getDirichletRowOffsets();
 }
 
 // Neumann BCs
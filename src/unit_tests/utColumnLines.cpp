@@ -0,0 +1,156 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <set>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include "Albany_AbstractMeshStruct.hpp"
+#include "Albany_NullSpaceUtils.hpp"
+
+namespace
+{
+
+// A layered mesh with numColumns2D columns of numLayers+1 nodes each, of
+// which only the nodes of the odd columns are owned, listed level by level.
+void
+checkLocalColumns(Teuchos::FancyOStream& out, bool& success,
+                  const Albany::LayeredMeshOrdering ordering)
+{
+  const LO numColumns2D = 6, numLayers = 4;
+  Teuchos::ArrayRCP<double> ratio(numLayers, 1.0/numLayers);
+  const LO stride = (ordering == Albany::LayeredMeshOrdering::LAYER) ?
+                    numColumns2D : numLayers+1;
+  Albany::LayeredMeshNumbering<LO> numbering(stride, ordering, ratio);
+  TEST_EQUALITY(numbering.numLevels, numLayers+1);
+
+  Teuchos::Array<LO> ids, columns2D;
+  for (LO level = 0; level <= numLayers; ++level)
+    for (LO column = 1; column < numColumns2D; column += 2) {
+      ids.push_back(numbering.getId(column, level));
+      columns2D.push_back(column);
+    }
+
+  Teuchos::Array<LO> columnIds(ids.size()), levelIds(ids.size());
+  const LO numColumns =
+    numbering.getLocalColumns(ids(), columnIds(), levelIds());
+  TEST_EQUALITY(numColumns, numColumns2D/2);
+
+  // Nodes are in the same local column iff they are in the same column of
+  // the mesh, and the local columns are contiguous.
+  std::set<LO> seen;
+  for (int i = 0; i < ids.size(); ++i) {
+    TEST_COMPARE(columnIds[i], >=, 0);
+    TEST_COMPARE(columnIds[i], <, numColumns);
+    TEST_EQUALITY(levelIds[i], LO(i/numColumns));
+    TEST_EQUALITY(numbering.getId(columns2D[i], levelIds[i]), ids[i]);
+    for (int j = 0; j < ids.size(); ++j)
+      TEST_EQUALITY(columnIds[i] == columnIds[j], columns2D[i] == columns2D[j]);
+    seen.insert(columnIds[i]);
+  }
+  TEST_EQUALITY(LO(seen.size()), numColumns);
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+piroParams(const std::string& precType)
+{
+  Teuchos::RCP<Teuchos::ParameterList> piro = Teuchos::rcp(new Teuchos::ParameterList("Piro"));
+  piro->set("Solver Type", "NOX");
+  Teuchos::ParameterList& strat = piro->sublist("NOX").sublist("Direction").
+    sublist("Newton").sublist("Stratimikos Linear Solver").sublist("Stratimikos");
+  strat.set("Preconditioner Type", precType);
+  return piro;
+}
+
+Teuchos::ParameterList&
+ifpack2Settings(const Teuchos::RCP<Teuchos::ParameterList>& piro)
+{
+  return piro->sublist("NOX").sublist("Direction").sublist("Newton").
+    sublist("Stratimikos Linear Solver").sublist("Stratimikos").
+    sublist("Preconditioner Types").sublist("Ifpack2").sublist("Ifpack2 Settings");
+}
+
+} // namespace
+
+TEUCHOS_UNIT_TEST(ColumnLines, LayerOrdering)
+{
+  checkLocalColumns(out, success, Albany::LayeredMeshOrdering::LAYER);
+}
+
+TEUCHOS_UNIT_TEST(ColumnLines, ColumnOrdering)
+{
+  checkLocalColumns(out, success, Albany::LayeredMeshOrdering::COLUMN);
+}
+
+// The column map must be replaced on every mesh update, not only the first.
+TEUCHOS_UNIT_TEST(ColumnLines, Ifpack2MapIsRebuilt)
+{
+  Teuchos::RCP<Teuchos::ParameterList> piro = piroParams("Ifpack2");
+  ifpack2Settings(piro).set("partitioner: type", "user");
+
+  Albany::RigidBodyModes rbm(1);
+  rbm.setPiroPL(piro);
+  TEST_ASSERT(rbm.isIfpack2Used());
+  TEST_ASSERT(rbm.isColumnLinesRequested());
+
+  Teuchos::ArrayRCP<LO> first(4), levels(4, 0);
+  first[0] = 0; first[1] = 1; first[2] = 0; first[3] = 1;
+  rbm.setColumnLines(first, 2, first, levels, 2);
+  TEST_ASSERT(rbm.isColumnLinesRequested());
+
+  // After an adapt the mesh has three columns.
+  Teuchos::ArrayRCP<LO> second(6), levels2(6, 0);
+  for (int i = 0; i < 6; ++i) second[i] = i/2;
+  rbm.setColumnLines(second, 3, second, levels2, 2);
+
+  const Teuchos::ParameterList& settings = ifpack2Settings(piro);
+  TEST_EQUALITY(settings.get<LO>("partitioner: local parts"), 3);
+  const Teuchos::ArrayRCP<LO> map =
+    settings.get<Teuchos::ArrayRCP<LO> >("partitioner: map");
+  TEST_EQUALITY(map.size(), second.size());
+  for (int i = 0; i < map.size(); ++i)
+    TEST_EQUALITY(map[i], second[i]);
+  TEST_EQUALITY(settings.get<std::string>("relaxation: container"), "Banded");
+}
+
+// A map given in the input is left alone.
+TEUCHOS_UNIT_TEST(ColumnLines, Ifpack2UserMap)
+{
+  Teuchos::RCP<Teuchos::ParameterList> piro = piroParams("Ifpack2");
+  ifpack2Settings(piro).set("partitioner: type", "user");
+  ifpack2Settings(piro).set("partitioner: map", Teuchos::ArrayRCP<LO>(4, 0));
+
+  Albany::RigidBodyModes rbm(1);
+  rbm.setPiroPL(piro);
+  TEST_ASSERT(!rbm.isColumnLinesRequested());
+}
+
+TEUCHOS_UNIT_TEST(ColumnLines, MueLuVertical)
+{
+  Teuchos::RCP<Teuchos::ParameterList> piro = piroParams("MueLu");
+  Teuchos::ParameterList& muelu = piro->sublist("NOX").sublist("Direction").
+    sublist("Newton").sublist("Stratimikos Linear Solver").sublist("Stratimikos").
+    sublist("Preconditioner Types").sublist("MueLu");
+  muelu.set("linedetection: orientation", "vertical");
+
+  Albany::RigidBodyModes rbm(1);
+  rbm.setPiroPL(piro);
+  TEST_ASSERT(rbm.isColumnLinesRequested());
+
+  for (int pass = 0; pass < 2; ++pass) {
+    const LO numColumns = 2 + pass;
+    Teuchos::ArrayRCP<LO> columns(2*numColumns), levels(2*numColumns);
+    for (int i = 0; i < columns.size(); ++i) {
+      columns[i] = i%numColumns;
+      levels[i] = i/numColumns;
+    }
+    rbm.setColumnLines(columns, numColumns, columns, levels, 2);
+    TEST_ASSERT(rbm.isColumnLinesRequested());
+
+    const Teuchos::ParameterList& level0 = muelu.sublist("level 0");
+    TEST_EQUALITY(level0.get<Teuchos::ArrayRCP<LO> >("LineDetection_VertLineIds").size(),
+                  columns.size());
+    TEST_EQUALITY(level0.get<int>("CoarseNumZLayers"), 2);
+  }
+}
@@ -0,0 +1,165 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <cmath>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include "Phalanx_FieldManager.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Workset.hpp"
+#include "PHAL_DOFInterpolation.hpp"
+#include "Albany_Layouts.hpp"
+
+namespace
+{
+
+typedef PHAL::AlbanyTraits Traits;
+typedef PHAL::AlbanyTraits::Jacobian Jacobian;
+typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+const int numCells = 3, numNodes = 4, numQPs = 2, neq = 2, offset = 1;
+const int numDeriv = neq*numNodes;
+
+// How the derivatives of the nodal values are filled.
+enum Seeding {
+  GATHER,   // only the slot seeded by the gather, neq*node+offset
+  DENSE,    // every slot
+  NONE      // no derivatives at all, e.g. a field computed from parameters
+};
+
+double nodeValue (int cell, int node) { return 1.0 + cell + 0.5*node; }
+double nodeDeriv (int cell, int node, int k) { return 0.25*(k+1) + 0.1*cell - 0.05*node; }
+double basis (int node, int qp) { return (qp == 0) ? 0.1*(node+1) : 0.4 - 0.1*node; }
+
+bool isSeeded (Seeding seeding, int node, int k)
+{
+  return seeding == DENSE || (seeding == GATHER && k == neq*node+offset);
+}
+
+//! Fills the nodal values and the basis functions.
+class SetNodeValues : public PHX::EvaluatorWithBaseImpl<Traits>,
+                      public PHX::EvaluatorDerived<Jacobian, Traits>
+{
+public:
+  SetNodeValues (const RCP<Albany::Layouts>& dl, const Seeding* seeding_) :
+    val_node ("Node Values", dl->node_scalar),
+    BF       ("BF", dl->node_qp_scalar),
+    seeding  (seeding_)
+  {
+    this->addEvaluatedField(val_node);
+    this->addEvaluatedField(BF);
+    this->setName("SetNodeValues");
+  }
+
+  void postRegistrationSetup (Traits::SetupData d, PHX::FieldManager<Traits>& fm)
+  {
+    this->utils.setFieldData(val_node, fm);
+    this->utils.setFieldData(BF, fm);
+  }
+
+  void evaluateFields (Traits::EvalData workset)
+  {
+    for (int cell=0; cell < numCells; ++cell)
+      for (int node=0; node < numNodes; ++node) {
+        for (int qp=0; qp < numQPs; ++qp)
+          BF(cell, node, qp) = basis(node, qp);
+        if (seeding[cell] == NONE) {
+          val_node(cell, node) = ScalarT(nodeValue(cell, node));
+          continue;
+        }
+        val_node(cell, node) = ScalarT(numDeriv, nodeValue(cell, node));
+        for (int k=0; k < numDeriv; ++k)
+          val_node(cell, node).fastAccessDx(k) =
+            isSeeded(seeding[cell], node, k) ? nodeDeriv(cell, node, k) : 0.0;
+      }
+  }
+
+private:
+  PHX::MDField<ScalarT,Cell,Node> val_node;
+  PHX::MDField<RealType,Cell,Node,QuadPoint> BF;
+  const Seeding* seeding;
+};
+
+// Interpolates with the given seeding of each cell and compares with the
+// contraction done by hand.
+void
+checkInterpolation (Teuchos::FancyOStream& out, bool& success,
+                    const Seeding* seeding, const bool hasDerivs)
+{
+  const RCP<Albany::Layouts> dl =
+    rcp(new Albany::Layouts(numCells, numNodes, numNodes, numQPs, 2));
+
+  Teuchos::ParameterList p;
+  p.set<std::string>("Variable Name", "Node Values");
+  p.set<std::string>("BF Name", "BF");
+  p.set<int>("Offset of First DOF", offset);
+  RCP<PHAL::DOFInterpolation<Jacobian,Traits> > interp =
+    rcp(new PHAL::DOFInterpolation<Jacobian,Traits>(p, dl));
+
+  PHX::FieldManager<Traits> fm;
+  fm.registerEvaluator<Jacobian>(rcp(new SetNodeValues(dl, seeding)));
+  fm.registerEvaluator<Jacobian>(interp);
+  fm.requireField<Jacobian>(*interp->evaluatedFields()[0]);
+
+  std::vector<PHX::index_size_type> derivative_dimensions;
+  derivative_dimensions.push_back(numDeriv);
+  fm.setKokkosExtendedDataTypeDimensions<Jacobian>(derivative_dimensions);
+  PHAL::AlbanyTraits::SetupData setupData = "Test String";
+  fm.postRegistrationSetup(setupData);
+
+  PHAL::Workset workset;
+  workset.numCells = numCells;
+  workset.wsElNodeEqID =
+    Albany::AbstractDiscretization::WorksetConn("wsElNodeEqID", numCells, numNodes, neq);
+
+  fm.preEvaluate<Jacobian>(workset);
+  fm.evaluateFields<Jacobian>(workset);
+  fm.postEvaluate<Jacobian>(workset);
+
+  PHX::MDField<ScalarT,Cell,QuadPoint> val_qp("Node Values", dl->qp_scalar);
+  fm.getFieldData<ScalarT,Jacobian,Cell,QuadPoint>(val_qp);
+
+  const double tol = 1.0e-14;
+  for (int cell=0; cell < numCells; ++cell)
+    for (int qp=0; qp < numQPs; ++qp) {
+      const ScalarT& v = val_qp(cell, qp);
+      double val = 0.0;
+      for (int node=0; node < numNodes; ++node)
+        val += nodeValue(cell, node)*basis(node, qp);
+      TEST_FLOATING_EQUALITY(v.val(), val, tol);
+      if (!hasDerivs) {
+        for (int k=0; k < v.size(); ++k)
+          TEST_EQUALITY(v.dx(k), 0.0);
+        continue;
+      }
+      TEST_EQUALITY(v.size(), numDeriv);
+      for (int k=0; k < numDeriv; ++k) {
+        double dx = 0.0;
+        for (int node=0; node < numNodes; ++node)
+          if (isSeeded(seeding[cell], node, k))
+            dx += nodeDeriv(cell, node, k)*basis(node, qp);
+        TEST_COMPARE(std::fabs(v.dx(k) - dx), <=, tol);
+      }
+    }
+}
+
+} // namespace
+
+// Cells seeded by the gather take the sparse contraction, the others the
+// dense one; both must give the full FAD result.
+TEUCHOS_UNIT_TEST(DOFInterpolation, SparseAndDenseCells)
+{
+  const Seeding seeding[numCells] = {GATHER, DENSE, GATHER};
+  checkInterpolation(out, success, seeding, true);
+}
+
+// A nodal field with no derivatives must not take the sparse path.
+TEUCHOS_UNIT_TEST(DOFInterpolation, NoDerivatives)
+{
+  const Seeding seeding[numCells] = {NONE, NONE, NONE};
+  checkInterpolation(out, success, seeding, false);
+}
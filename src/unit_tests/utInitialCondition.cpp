@@ -0,0 +1,151 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Tpetra_DefaultPlatform.hpp>
+#include "AAdapt_AnalyticFunction.hpp"
+#include "AAdapt_InitialCondition.hpp"
+
+namespace
+{
+
+// Evaluates name on numPoints points, once with computeBatch and once with a
+// compute per point, and compares the two.
+void
+checkBatch(Teuchos::FancyOStream& out, bool& success, const std::string& name,
+           const int neq, const int numDim, const Teuchos::Array<double>& data)
+{
+  const int numPoints = 1000;
+  std::vector<double> X(numPoints*numDim);
+  for (int k=0; k<numPoints*numDim; k++)
+    X[k] = std::sin(0.37*k);
+
+  std::vector<double> batch(numPoints*neq, -1.0), single(numPoints*neq, -1.0);
+  AAdapt::createAnalyticFunction(name, neq, numDim, data)->computeBatch(
+      numPoints, neq, numDim, batch.data(), X.data());
+  Teuchos::RCP<AAdapt::AnalyticFunction> f =
+      AAdapt::createAnalyticFunction(name, neq, numDim, data);
+  for (int p=0; p<numPoints; p++)
+    f->compute(&single[p*neq], &X[p*numDim]);
+
+  TEST_COMPARE_ARRAYS(batch, single);
+}
+
+// Returns the number of calls made before each point, so computeBatch has to
+// visit the points in order.
+class CallCounter : public AAdapt::AnalyticFunction {
+  public:
+    CallCounter() : calls(0) {}
+    void compute(double* x, const double* X) { x[0] = calls++; }
+    bool isThreadSafe() const { return false; }
+  private:
+    int calls;
+};
+
+// Three nodes on a line, in two elements of one workset, one equation
+struct LineMesh {
+  LineMesh() : wsEBNames(1, std::string("Block0")), coords(1) {
+    Teuchos::RCP<const Teuchos_Comm> comm =
+      Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+    map = Teuchos::rcp(new Tpetra_Map(3, 0, comm, Tpetra::LocallyReplicated));
+
+    wsElNodeEqID = Albany::AbstractDiscretization::Conn(1);
+    wsElNodeEqID[0] = Albany::AbstractDiscretization::WorksetConn("wsElNodeEqID", 2, 2, 1);
+    nodeCoords.resize(6);
+    for (int n=0; n<3; n++) {
+      nodeCoords[2*n] = n;
+      nodeCoords[2*n+1] = 0.5*n;
+    }
+    coords[0] = Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> >(2);
+    for (int el=0; el<2; el++) {
+      coords[0][el] = Teuchos::ArrayRCP<double*>(2);
+      for (int ln=0; ln<2; ln++) {
+        wsElNodeEqID[0](el,ln,0) = el+ln;
+        coords[0][el][ln] = &nodeCoords[2*(el+ln)];
+      }
+    }
+  }
+
+  // The initial condition of a run with these parameters, from a zero vector
+  Teuchos::RCP<Tpetra_Vector> compute(const Teuchos::ParameterList& params) {
+    Teuchos::RCP<Tpetra_Vector> solnT = Teuchos::rcp(new Tpetra_Vector(map, true));
+    Teuchos::ParameterList icParams(params);
+    AAdapt::InitialConditionsT(solnT, wsElNodeEqID, wsEBNames, coords, 1, 2, icParams);
+    return solnT;
+  }
+
+  Teuchos::RCP<const Tpetra_Map> map;
+  Albany::AbstractDiscretization::Conn wsElNodeEqID;
+  Teuchos::ArrayRCP<std::string> wsEBNames;
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords;
+  std::vector<double> nodeCoords;
+};
+
+// Replaces the values stored in a cache file, keeping its key.
+void
+overwriteCache(const std::string& fileName, const double value)
+{
+  std::fstream f(fileName.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+  f.seekp(sizeof(std::uint64_t) + sizeof(std::int64_t));
+  for (int i=0; i<3; i++)
+    f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // anonymous namespace
+
+TEUCHOS_UNIT_TEST(InitialCondition, BatchMatchesCompute)
+{
+  checkBatch(out, success, "Sin-Cos", 3, 2, Teuchos::Array<double>());
+  checkBatch(out, success, "About Z", 2, 2, Teuchos::Array<double>(1, 0.7));
+  checkBatch(out, success, "Linear", 2, 3,
+             Teuchos::Array<double>(Teuchos::tuple(1.0, -2.0, 0.5, 3.0, 0.25, -1.0)));
+}
+
+TEUCHOS_UNIT_TEST(InitialCondition, BatchKeepsOrderOfStatefulFunctions)
+{
+  const int numPoints = 100;
+  std::vector<double> x(numPoints), X(numPoints);
+  CallCounter f;
+  f.computeBatch(numPoints, 1, 1, x.data(), X.data());
+  for (int p=0; p<numPoints; p++)
+    TEST_EQUALITY(x[p], p);
+}
+
+TEUCHOS_UNIT_TEST(InitialCondition, CacheKeyFollowsParameters)
+{
+  const std::string cacheFile = "utInitialCondition.cache";
+  Teuchos::RCP<const Teuchos_Comm> comm =
+    Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+  std::ostringstream fileName;
+  fileName << cacheFile << "." << comm->getSize() << "." << comm->getRank();
+  std::remove(fileName.str().c_str());
+
+  LineMesh mesh;
+  Teuchos::ParameterList params;
+  params.set("Function", "Constant");
+  params.set("Function Data", Teuchos::Array<double>(1, 1.0));
+  params.set("IC Cache File", cacheFile);
+
+  // The first run computes and writes the cache
+  TEST_FLOATING_EQUALITY(mesh.compute(params)->meanValue(), 1.0, 1.0e-14);
+  TEST_ASSERT(std::ifstream(fileName.str().c_str()).good());
+
+  // The same parameters read the cache back, whatever it holds
+  overwriteCache(fileName.str(), 7.0);
+  TEST_FLOATING_EQUALITY(mesh.compute(params)->meanValue(), 7.0, 1.0e-14);
+
+  // A changed parameter invalidates it
+  params.set("Function Data", Teuchos::Array<double>(1, 2.0));
+  TEST_FLOATING_EQUALITY(mesh.compute(params)->meanValue(), 2.0, 1.0e-14);
+
+  std::remove(fileName.str().c_str());
+}
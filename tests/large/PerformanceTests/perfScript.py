@@ -1,20 +1,61 @@
 #! /usr/bin/env python
 # usage:  python this-script -machine machineName -executable executableName
+#           [-source albanySourceDir] [-results resultsDir] [-repeat n]
+#           [-update-baseline] [-verbose]
 #  errors will be in:  perfTest.log
 #
+# Runs the problem listed for this machine in data.perf and checks
+#  1) the total wallclock time against the data.perf entry (as before), and
+#  2) the time of each named phase (setup, fills, linear solve, output),
+#     parsed from the Teuchos::TimeMonitor summary, against the statistics
+#     stored for this machine in perfBaseline.json, if any.
+#
+# The phase times of every run are written to perfResults.json and, if a
+# results directory is given, to resultsDir/<testName>/<machine>/<commit>.json.
+# -update-baseline recomputes perfBaseline.json (in the current directory)
+# from all results stored for this test and machine.
+#
 # Thanks to Dave Littlewood for creating this script  10/2013.
 
 import sys
 import os
+import re
 import glob
-import string
+import json
+import math
+import time
 from subprocess import Popen, PIPE
 
 base_name = "perfTest"
+baseline_file_name = "perfBaseline.json"
+results_file_name = "perfResults.json"
+
+# Phases tracked by the harness: each is the sum of the TimeMonitor timers
+#  whose name matches the regular expression. A list of expressions is
+#  tried in order and the first one matching any timer is used, so that
+#  nested timers (NOX around Belos or AztecOO) are not counted twice.
+phases = [
+    ("total",         r"Albany: \*\*\*Total Time\*\*\*"),
+    ("setup",         r"Albany: Setup Time"),
+    ("residual fill", r"> Albany Fill: Residual"),
+    ("jacobian fill", r"> Albany Fill: Jacobian$"),
+    ("linear solve",  [r"NOX Total Linear Solve", r"Belos: .*total solve time", r"AztecOO"]),
+    ("output",        r"Albany: Output to File"),
+]
+
+# A phase regresses if it is slower than the baseline mean by more than
+#  sigma_factor standard deviations AND by more than min_rel_tolerance of the
+#  mean, so that phases with a tiny spread do not fail on noise.
+sigma_factor = 3.0
+min_rel_tolerance = 0.10
+# Phases shorter than this are too noisy to check
+min_checked_time = 0.05
+
+number_re = re.compile(r"^-?\d+(\.\d*)?([eE][-+]?\d+)?$")
 
 def read_line(file):
     """Scans the input file and ignores lines starting with a '#' or '\n'."""
-    
+
     buff = file.readline()
     if len(buff) == 0: return None
     while buff[0] == '#' or buff[0] == '\n':
@@ -22,6 +63,88 @@ def read_line(file):
         if len(buff) == 0: return None
     return buff
 
+def parse_timers(out):
+    """Returns {timer name: time} from a TimeMonitor summary.
+
+    Rows look like "name  t" on one process, or
+    "name  min (n)  mean (n)  max (n)  meanOverCalls (n)" on several; the
+    max over processes is used in that case.
+    """
+    timers = {}
+    for line in out.splitlines():
+        tokens = line.split()
+        values = []
+        name_end = len(tokens)
+        for i in range(len(tokens)-1, -1, -1):
+            token = tokens[i]
+            if token.startswith("(") and token.endswith(")"):
+                continue
+            if number_re.match(token) is None:
+                break
+            values.insert(0, float(token))
+            name_end = i
+        if len(values) == 0 or name_end == 0:
+            continue
+        name = " ".join(tokens[:name_end])
+        timers[name] = values[2] if len(values) >= 3 else values[0]
+    return timers
+
+def phase_times(timers):
+    """Sums the timers belonging to each phase; phases with no timer are omitted."""
+    times = {}
+    for phase, patterns in phases:
+        if isinstance(patterns, str):
+            patterns = [patterns]
+        for pattern in patterns:
+            regex = re.compile(pattern)
+            matches = [t for name, t in timers.items() if regex.search(name)]
+            if len(matches) > 0:
+                times[phase] = sum(matches)
+                break
+    return times
+
+def median(values):
+    values = sorted(values)
+    n = len(values)
+    return values[n//2] if n % 2 == 1 else 0.5*(values[n//2-1] + values[n//2])
+
+def get_commit(source_dir):
+    if "ALBANY_COMMIT" in os.environ:
+        return os.environ["ALBANY_COMMIT"]
+    if source_dir is None:
+        return "unknown"
+    try:
+        p = Popen(["git", "-C", source_dir, "rev-parse", "--short", "HEAD"], stdout=PIPE, stderr=PIPE)
+        out, err = p.communicate()
+        if p.returncode == 0:
+            return out.decode().strip()
+    except OSError:
+        pass
+    return "unknown"
+
+def update_baseline(results_dir, machine_name, logfile):
+    """Recomputes the baseline statistics of this machine from the stored results."""
+    samples = {}
+    for file_name in glob.glob(os.path.join(results_dir, "*.json")):
+        with open(file_name) as f:
+            for phase, t in json.load(f)["phases"].items():
+                samples.setdefault(phase, []).append(t)
+
+    baseline = {}
+    if os.path.exists(baseline_file_name):
+        with open(baseline_file_name) as f:
+            baseline = json.load(f)
+    stats = {}
+    for phase, values in samples.items():
+        n = len(values)
+        mean = sum(values)/n
+        stddev = math.sqrt(sum((v-mean)**2 for v in values)/(n-1)) if n > 1 else 0.0
+        stats[phase] = {"mean": mean, "stddev": stddev, "samples": n}
+    baseline[machine_name] = stats
+    with open(baseline_file_name, 'w') as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+    logfile.write("\n**** Baseline for " + machine_name + " updated from " + results_dir + "\n")
+
 if __name__ == "__main__":
 
     result = 0
@@ -45,18 +168,32 @@ if __name__ == "__main__":
         logfile.write("\n**** Error, machine name argument required (-machine my_machine_name)\n")
         result = 1
 
+    source_dir = None
+    if "-source" in sys.argv:
+        source_dir = sys.argv[sys.argv.index("-source") + 1]
+
+    results_dir = None
+    if "-results" in sys.argv and len(sys.argv[sys.argv.index("-results") + 1]) > 0:
+        results_dir = os.path.join(sys.argv[sys.argv.index("-results") + 1],
+                                   os.path.basename(os.getcwd()), machine_name)
+
+    num_repeat = 1
+    if "-repeat" in sys.argv:
+        num_repeat = max(1, int(sys.argv[sys.argv.index("-repeat") + 1]))
+
     # gold standard performance data for this machine
     perf_gold_file = open("data.perf")
     buff = read_line(perf_gold_file)
     gold_perf_data = []
     while buff != None:
-        vals = string.splitfields(buff)
+        vals = buff.split()
         if machine_name in vals:
             gold_perf_data = vals
         buff = read_line(perf_gold_file)
     if gold_perf_data == []:
         logfile.write("\n**** Error, reference (gold) performance data not found for machine " + machine_name + "\n")
-        result = 1
+        logfile.close()
+        sys.exit(1)
     gold_num_proc = int(gold_perf_data[1])
     gold_wallclock_time = float(gold_perf_data[2])
     gold_wallclock_time_tolerance = float(gold_perf_data[3])
@@ -74,28 +211,38 @@ if __name__ == "__main__":
 
     if gold_num_proc == 1:
     # run Albany: serial for now
-        command = [executable_name, input_file_name]    
+        command = [executable_name, input_file_name]
     else:
-        command = ["mpirun", "-np", gold_perf_data[1], executable_name, input_file_name]    
-
-    p = Popen(command, stdout=PIPE)
-    return_code = p.wait()
-    if return_code != 0:
-        result = return_code
-    out, err = p.communicate()
-    if out != None:
+        command = ["mpirun", "-np", gold_perf_data[1], executable_name, input_file_name]
+
+    # run (possibly several times) and keep the median time of each phase
+    phase_samples = {}
+    wallclock_samples = []
+    for run in range(num_repeat):
+        p = Popen(command, stdout=PIPE)
+        out, err = p.communicate()
+        if p.returncode != 0:
+            result = p.returncode
+        out = out.decode() if out != None else ""
         logfile.write(out)
-    if err != None:
-        logfile.write(err)
-    logfile.flush()
-        
-    # compare performance statistics against gold statistics
+        if err != None:
+            logfile.write(err.decode())
+        logfile.flush()
+
+        # performance data for current run
+        stdout_vals = out.split()
+        if "Time***" in stdout_vals:
+            wallclock_samples.append(float(stdout_vals[stdout_vals.index("Time***")+1]))
+        for phase, t in phase_times(parse_timers(out)).items():
+            phase_samples.setdefault(phase, []).append(t)
 
-    # performance data for current run
-    stdout_vals = string.splitfields(out)
-    wallclock_time_index = stdout_vals.index("Time***")
-    wallclock_time = float(stdout_vals[wallclock_time_index+1])
+    if len(wallclock_samples) == 0:
+        logfile.write("\n**** PERFORMANCE TEST FAILED:  no timing output found.\n")
+        logfile.close()
+        sys.exit(1)
 
+    # compare performance statistics against gold statistics
+    wallclock_time = median(wallclock_samples)
 
     if(wallclock_time > gold_wallclock_time + gold_wallclock_time_tolerance):
         result = 1
@@ -109,7 +256,47 @@ if __name__ == "__main__":
     logfile.write("\n****                           benchmark value = " +  str(gold_wallclock_time))
     logfile.write("\n****                           tolerance       = " +  str(gold_wallclock_time_tolerance) +"\n")
     logfile.flush()
-          
+
+    # record phase times of this commit
+    times = dict((phase, median(samples)) for phase, samples in phase_samples.items())
+    record = {"machine": machine_name,
+              "commit": get_commit(source_dir),
+              "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+              "num_proc": gold_num_proc,
+              "repeat": num_repeat,
+              "phases": times}
+    with open(results_file_name, 'w') as f:
+        json.dump(record, f, indent=2, sort_keys=True)
+    if results_dir != None:
+        if not os.path.isdir(results_dir):
+            os.makedirs(results_dir)
+        with open(os.path.join(results_dir, record["commit"] + ".json"), 'w') as f:
+            json.dump(record, f, indent=2, sort_keys=True)
+        if "-update-baseline" in sys.argv:
+            update_baseline(results_dir, machine_name, logfile)
+
+    # compare phase times against the baseline of this machine, if any
+    baseline = {}
+    if os.path.exists(baseline_file_name):
+        with open(baseline_file_name) as f:
+            baseline = json.load(f).get(machine_name, {})
+    if baseline == {}:
+        logfile.write("\n**** No phase baseline for machine " + machine_name + " in " + baseline_file_name + "\n")
+    for phase, pattern in phases:
+        if phase not in times or phase not in baseline:
+            continue
+        t = times[phase]
+        mean = baseline[phase]["mean"]
+        allowed = mean + max(sigma_factor*baseline[phase]["stddev"], min_rel_tolerance*mean)
+        if mean >= min_checked_time and t > allowed:
+            result = 1
+            status = "REGRESSED"
+        else:
+            status = "ok"
+        logfile.write("\n**** phase %-14s time = %10.4f  baseline = %10.4f  allowed = %10.4f  %s"
+                      % (phase, t, mean, allowed, status))
+    logfile.write("\n")
+
     # compare output against gold file only if the gold file is present
     logfile.close()
 
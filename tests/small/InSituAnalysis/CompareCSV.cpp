@@ -0,0 +1,91 @@
+// Checks the CSV files written by the In Situ Analysis observer.
+//
+//   CompareCSV <test.csv> <reference.csv> <relative tolerance>
+//     The files must have the same header and number of rows, and all
+//     values must agree to the tolerance.
+//   CompareCSV <test.csv> -sum <expected>
+//     The values of every row (the stamp excluded) must add up to expected.
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static bool readCSV(const char* name, string& header,
+                    vector<vector<double> >& rows)
+{
+  ifstream in(name);
+  if (!in || !getline(in, header)) {
+    cerr << "Cannot read " << name << endl;
+    return false;
+  }
+  string line;
+  while (getline(in, line)) {
+    vector<double> row;
+    istringstream ls(line);
+    string item;
+    while (getline(ls, item, ',')) row.push_back(atof(item.c_str()));
+    rows.push_back(row);
+  }
+  if (rows.empty()) {
+    cerr << name << " has no rows" << endl;
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4) {
+    cerr << "Usage: CompareCSV test.csv (reference.csv tolerance | -sum expected)"
+         << endl;
+    return 1;
+  }
+
+  string header;
+  vector<vector<double> > rows;
+  if (!readCSV(argv[1], header, rows)) return 1;
+
+  if (string(argv[2]) == "-sum") {
+    const double expected = atof(argv[3]);
+    for (size_t r = 0; r < rows.size(); ++r) {
+      double sum = 0;
+      for (size_t i = 1; i < rows[r].size(); ++i) sum += rows[r][i];
+      if (sum != expected) {
+        cerr << argv[1] << ", row " << r << ": values add up to " << sum
+             << ", expected " << expected << endl;
+        return 1;
+      }
+    }
+    return 0;
+  }
+
+  string refHeader;
+  vector<vector<double> > refRows;
+  if (!readCSV(argv[2], refHeader, refRows)) return 1;
+  const double tol = atof(argv[3]);
+  if (header != refHeader || rows.size() != refRows.size()) {
+    cerr << argv[1] << " and " << argv[2] << " differ in layout" << endl;
+    return 1;
+  }
+  for (size_t r = 0; r < rows.size(); ++r) {
+    if (rows[r].size() != refRows[r].size()) {
+      cerr << "Row " << r << " differs in length" << endl;
+      return 1;
+    }
+    for (size_t i = 0; i < rows[r].size(); ++i) {
+      const double a = rows[r][i], b = refRows[r][i];
+      if (fabs(a - b) > tol*max(fabs(b), 1.0)) {
+        cerr << "Row " << r << ", column " << i << ": " << a << " vs " << b
+             << endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
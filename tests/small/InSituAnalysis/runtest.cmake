@@ -0,0 +1,46 @@
+# Runs Albany on one and on several ranks and checks that the In Situ
+# Analysis output does not depend on the number of ranks.
+
+# 1. Run Albany serially and keep its output as the reference
+
+message("Running the command:")
+message("${SERIAL_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${SERIAL_PROG} ${TEST_ARGS}
+                RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+	message(FATAL_ERROR "Serial Albany didn't run: test failed")
+endif()
+
+file(RENAME histogram.csv histogram_serial.csv)
+file(RENAME probe.csv probe_serial.csv)
+
+# 2. Run Albany in parallel
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+	message(FATAL_ERROR "Albany didn't run: test failed")
+endif()
+
+# 3. Every node is counted once by the histogram (41 x 41 nodes), and the
+#    probed values match the serial run up to the linear solver tolerance
+
+foreach(CHECK "histogram_serial.csv;-sum;1681"
+              "histogram.csv;-sum;1681"
+              "probe.csv;probe_serial.csv;1.0e-4")
+	message("Running the command:")
+	message("${AUX_PROG} " " ${CHECK}")
+
+	EXECUTE_PROCESS(COMMAND ${AUX_PROG} ${CHECK}
+	                RESULT_VARIABLE HAD_ERROR)
+
+	if(HAD_ERROR)
+		message(FATAL_ERROR "In situ output check failed: test failed")
+	endif()
+endforeach()